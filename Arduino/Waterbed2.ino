@@ -49,15 +49,31 @@
 #include <TimeLib.h> // http://www.pjrc.com/teensy/td_libs_Time.html
 #include <UdpTime.h> // https://github.com/CuriousTech/ESP07_WiFiGarageDoor/tree/master/libraries/UdpTime
 #include "eeMem.h"
+#include "schedule.h"
+#include "alarms.h"
 #include "RunningMedian.h"
 #include <JsonParse.h> // https://github.com/CuriousTech/ESP8266-HVAC/tree/master/Libraries/JsonParse
-#include <JsonClient.h>
+#include "callQueue.h"
 #include <SHT21.h> // https://github.com/CuriousTech/ESP8266-HVAC/tree/master/Libraries/SHT21
 #include "jsonstring.h"
 #include "uriString.h"
 #include "display.h"
 #include "tempArray.h"
 #include "music.h"
+#include "telemetry.h"
+#include "discovery.h"
+#include "monoTime.h"
+#include "tasks.h"
+#include "sensors.h"
+#include "presence.h"
+#include "devCache.h"
+#include "mpscQueue.h"
+#include "seqLock.h"
+#include "respCache.h"
+#include "wsTopics.h"
+#include "clientLimit.h"
+#include "journal.h"
+#include <WiFiUdp.h>
 
 #include <WebSocketsClient.h> // https://github.com/Links2004/arduinoWebSockets
 //switch WEBSOCKETS_NETWORK_TYPE to NETWORK_ESP8266_ASYNC in WebSockets.h
@@ -68,7 +84,12 @@
 const char controlPassword[] = "password";    // device password for modifying any settings
 const int serverPort = 80;                    // HTTP port
 const char hostName[] = "WaterbedM2";
+const char *peerName[] = {"HVAC", "Dimmer", "Fan", "Host"}; // mDNS names of the other devices, in peerId order
 #define WBID 0x4254574d // Sensor ID for thermostat MWTB   0x42545747 = GWTB
+//#define TELEM_KEY "0123456789ABCDEF" // 16 chars, signs the UDP telemetry. Must match the HVAC
+#define TELEM_DEADBAND  2   // 0.2 deg
+#define TELEM_RHBAND    10  // 1% RH
+#define TELEM_INTERVAL  60  // seconds between packets when nothing changes
 
 #ifdef ESP32
 
@@ -85,10 +106,10 @@ const char hostName[] = "WaterbedM2";
 #define ENC_B    33
 
 #include <ld2410.h> // from Library Manager in Arduino IDE
+#include "occupancy.h"
 #define RADAR_SERIAL Serial1
-ld2410 radar;
-uint32_t lastReading = 0;
-bool radarConnected = false;
+ld2410 radar; // setup commands only, the sensor task parses the frames
+Occupancy occ;
 
 #else
 
@@ -110,34 +131,44 @@ Music mus;
 
 OneWire ds(DS18B20);
 byte ds_addr[8];
-IPAddress lastIP;
-int nWrongPass;
+IPAddress lastIP; // sender of the commands being parsed
+ClientLimit clientLimit;
 
 SHT21 sht(SDA, SCL, 4);
 uint16_t light;
 
 Display display;
 eeMem ee;
+Schedule sched;
+Alarms alarms;
+Discovery peers;
+WallClock wallClock;
+Tasks tasks;
+Sensors sensors;
+Presence presence;
+DevCache devCache;
+RespCache respCache;
+Journal journal;
+int8_t tState = -1; // sendState() at ee.rate
+int8_t tLight = -1; // in bed light timer
 
 AsyncWebServer server( serverPort );
 AsyncWebSocket ws("/ws"); // access at ws://[esp ip]/ws
+WsTopics topics(&ws);
 
 UdpTime udptime;
 
 bool bCF = false;
 
 uint32_t onCounter;
-bool bMotion = true;
 bool bNotifAck = false;
-uint8_t nAlarming;
-uint16_t nSnoozeTimer;
 
 uint32_t nHeatCnt;
 uint32_t nCoolCnt;
 uint32_t nOvershootCnt;
 uint32_t nOvershootPeak;
-uint32_t nHeatETA;
-uint32_t nCoolETA;
+MonoTimer heatETA; // when the target temp should be reached
+MonoTimer coolETA;
 bool bBoost;
 uint16_t nOvershootStartTemp;
 uint16_t nOvershootEndTemp;
@@ -145,251 +176,613 @@ int16_t nOvershootTempDiff;
 uint32_t nOvershootTime;
 bool bTxTemp;
 
-bool bConfigDone = false;
 bool bStarted = false;
-uint32_t connectTimer;
+MonoTimer wifiTimer;
+
+enum wifiState
+{
+  WF_FAST,     // last BSSID and channel, no scan
+  WF_SCAN,     // full scan
+  WF_WAIT,     // pause before trying again, the router may be restarting
+  WF_SMART,    // SmartConfig
+  WF_CONNECTED,
+};
+uint8_t wifiState;
+uint8_t wifiFails; // connect cycles since the last connection
 
 void jsonCallback(int16_t iName, int iValue, char *psValue);
 JsonParse jsonParse(jsonCallback);
 void jsonPushCallback(int16_t iName, int iValue, char *psValue);
-JsonClient jsonPush(jsonPushCallback);
+extern const char *jsonListPush[];
+CallQueue callQueue(jsonPushCallback, jsonListPush);
 
 bool updateAll(bool bForce)
 {
   return ee.update(bForce);
 }
 
+struct stateSnap // what dataJson() reports
+{
+  uint32_t t;
+  uint32_t oc;
+  uint32_t eta;
+  uint32_t coolEta;
+  uint16_t waterTemp;
+  uint16_t setTemp;
+  uint16_t hiTemp;
+  uint16_t loTemp;
+  uint16_t roomTemp;
+  uint16_t rh;
+  bool     bOn;
+  bool     bMotion;
+  bool     bNotif;
+  bool     bPin;
+};
+
+struct setSnap // what setJson() reports
+{
+  uint32_t tSecsMon[12];
+  uint16_t scheduleDays[4];
+  uint8_t  schedCnt[4];
+  uint8_t  hostIP[4];
+  uint8_t  lightIP[4];
+  uint8_t  fanIP[4];
+  uint8_t  idx;
+  uint8_t  season;
+#define SNAP_SETTING(t, m, d, c, j, k, lo, hi, fn) t m;
+  SETTINGS(SNAP_SETTING)
+};
+
+struct schedSnap // what schedJson() reports
+{
+  uint8_t cnt[4];
+  Sched   item[SCHED_POOL]; // seasons back to back, as in ee.schedule
+};
+
+SeqLock<stateSnap> stateLock; // written by loop(), read from any task
+SeqLock<setSnap> setLock;
+SeqLock<schedSnap> schedLock; // loop() moves entries around in ee.schedule when a season changes size
+
+uint32_t utcTime()
+{
+  return now() - ((ee.tz + udptime.getDST()) * 3600);
+}
+
+void sendAlert(const char *pMsg) // to the pages, and kept for ones that reconnect
+{
+  jsonString js("alert");
+  js.Var("data", pMsg);
+  topics.publish(TP_ALERT, js.Close(), true);
+  journal.add(JE_ALERT, 0, pMsg);
+}
+
+int8_t nSchedChg = -1; // season edited by the last commands, or SCHED_ALL
+
+#define JN_STATE_MS  60000 // ms between journaled heat and setpoint changes
+#define JN_EDIT_WAIT 5000  // ms after the last schedule edit on the screen before it's journaled
+
+void publishState() // loop() only
+{
+  static stateSnap lastSt;
+  static setSnap lastSet;
+  static schedSnap lastSched;
+  stateSnap st;
+
+  memset(&st, 0, sizeof(st));
+  st.t = utcTime();
+  st.oc = onCounter;
+  st.eta = heatETA.remaining() / 1000;
+  st.coolEta = coolETA.remaining() / 1000;
+  st.waterTemp = display.m_currentTemp;
+  st.setTemp = sched.day(display.m_schInd).setTemp;
+  st.hiTemp = display.m_hiTemp;
+  st.loTemp = display.m_loTemp;
+  st.roomTemp = display.m_roomTemp;
+  st.rh = display.m_rh;
+  st.bOn = digitalRead(HEAT);
+  st.bMotion = presence.present();
+  st.bNotif = bNotifAck;
+  st.bPin = digitalRead(MOTION);
+  stateLock.write(st);
+
+  static uint32_t jnStateMs;
+  static int16_t jnHeat = -1, jnSetpoint = -1; // last journaled
+
+  if (millis() - jnStateMs >= JN_STATE_MS) // the latest of them, the journal isn't a history
+  {
+    bool bAdded = false;
+    if (st.bOn != jnHeat)
+    {
+      jnHeat = st.bOn;
+      journal.add(JE_HEAT, st.bOn);
+      bAdded = true;
+    }
+    if (st.hiTemp != jnSetpoint)
+    {
+      jnSetpoint = st.hiTemp;
+      journal.add(JE_SETPOINT, st.hiTemp);
+      bAdded = true;
+    }
+    if (bAdded)
+      jnStateMs = millis();
+  }
+
+  stateSnap cmp = st; // the clock and ETAs only count by the minute, so pollers can get a 304
+  cmp.t /= 60;
+  cmp.eta /= 60;
+  cmp.coolEta /= 60;
+  if (memcmp(&cmp, &lastSt, sizeof(cmp)))
+  {
+    lastSt = cmp;
+    respCache.changed(RC_STATE);
+    respCache.changed(RC_HIST); // its last point is the current state
+  }
+  respCache.build(RC_HIST);
+
+  setSnap ss;
+
+  memset(&ss, 0, sizeof(ss));
+  memcpy(ss.tSecsMon, ee.tSecsMon, sizeof(ss.tSecsMon));
+  memcpy(ss.scheduleDays, ee.scheduleDays, sizeof(ss.scheduleDays));
+  memcpy(ss.schedCnt, ee.schedCnt, sizeof(ss.schedCnt));
+  memcpy(ss.hostIP, ee.hostIP, 4);
+  memcpy(ss.lightIP, ee.lightIP[0], 4);
+  memcpy(ss.fanIP, ee.lightIP[1], 4);
+  ss.idx = sched.dayItem(display.m_schInd);
+  ss.season = display.m_season;
+#define SNAP_COPY(t, m, d, c, j, k, lo, hi, fn) ss.m = ee.m;
+  SETTINGS(SNAP_COPY)
+  setLock.write(ss);
+
+  if (memcmp(&ss, &lastSet, sizeof(ss)))
+  {
+#define SNAP_CHG(t, m, d, c, j, k, lo, hi, fn) || ss.m != lastSet.m
+    if (false SETTINGS(SNAP_CHG)) // not the energy totals
+      journal.add(JE_SET, 0);
+    lastSet = ss;
+    respCache.changed(RC_SET);
+  }
+
+  static uint32_t schedEditMs;
+  static bool bSchedEdit; // on the screen or the buttons, commands journal their own
+  static bool bSchedSnap; // the first snapshot isn't an edit
+
+  if (memcmp(lastSched.cnt, ee.schedCnt, sizeof(lastSched.cnt)) || memcmp(lastSched.item, ee.schedule, sizeof(lastSched.item)))
+  {
+    memcpy(lastSched.cnt, ee.schedCnt, sizeof(lastSched.cnt));
+    memcpy(lastSched.item, ee.schedule, sizeof(lastSched.item));
+    schedLock.write(lastSched);
+    if (bSchedSnap && nSchedChg < 0)
+    {
+      bSchedEdit = true;
+      schedEditMs = millis();
+    }
+    bSchedSnap = true;
+  }
+  if (bSchedEdit && millis() - schedEditMs >= JN_EDIT_WAIT) // once the presses stop
+  {
+    bSchedEdit = false;
+    journal.add(JE_SET, SCHED_ALL);
+  }
+}
+
 String dataJson()
 {
+  stateSnap st;
+  stateLock.read(st);
+
   jsonString js("state");
 
-  js.Var("t", (uint32_t)(now() - ((ee.tz + udptime.getDST()) * 3600)) );
-  js.Var("waterTemp", String((float)display.m_currentTemp / 10, 1) );
-  js.Var("setTemp", String((float)ee.schedule[display.m_season][display.m_schInd].setTemp / 10, 1) );
-  js.Var("hiTemp",  String((float)display.m_hiTemp / 10, 1) );
-  js.Var("loTemp",  String((float)display.m_loTemp / 10, 1) );
-  js.Var("on",   digitalRead(HEAT));
-  js.Var("temp", String((float)display.m_roomTemp / 10, 1) );
-  js.Var("rh",   String((float)display.m_rh / 10, 1) );
+  js.Var("t", st.t);
+  js.Var("waterTemp", String((float)st.waterTemp / 10, 1) );
+  js.Var("setTemp", String((float)st.setTemp / 10, 1) );
+  js.Var("hiTemp",  String((float)st.hiTemp / 10, 1) );
+  js.Var("loTemp",  String((float)st.loTemp / 10, 1) );
+  js.Var("on",   st.bOn);
+  js.Var("temp", String((float)st.roomTemp / 10, 1) );
+  js.Var("rh",   String((float)st.rh / 10, 1) );
   js.Var("c",    String((bCF) ? "C" : "F"));
-  js.Var("oc",   onCounter );
-  js.Var("mot",  bMotion);
-  js.Var("eta",  nHeatETA);
-  js.Var("cooleta",  nCoolETA);
-  js.Var("notif",  bNotifAck);
-  js.Var("pin", digitalRead(MOTION));
-  bNotifAck = false;
+  js.Var("oc",   st.oc );
+  js.Var("mot",  st.bMotion);
+  js.Var("eta",  st.eta);
+  js.Var("cooleta",  st.coolEta);
+  js.Var("notif",  st.bNotif);
+  js.Var("pin", st.bPin);
   return js.Close();
 }
 
+void settingJson(jsonString &js, const char *key, uint8_t kind, int v)
+{
+  if (kind == SK_TENTHS)
+    js.Var(key, String((float)v / 10, 1) );
+  else if (kind == SK_BOOL)
+    js.Var(key, v ? true : false);
+  else
+    js.Var(key, v);
+}
+
 String setJson() // settings
 {
+  setSnap ss;
+  setLock.read(ss);
+
   jsonString js("set");
 
-  js.Var("vt", String((float)ee.vacaTemp / 10, 1) );
+#define SET_JSON(t, m, d, c, j, k, lo, hi, fn) settingJson(js, j, k, ss.m);
+  SETTINGS(SET_JSON)
   js.Var("o",   0);
-  js.Var("tz",  ee.tz);
-  js.Var("avg", ee.bAvg);
-  js.Var("ppkwh", ee.ppkwh);
-  js.Var("vo",  ee.bVaca);
-  js.Var("idx", display.m_schInd);
-  js.Array("cnt", ee.schedCnt, 4);
-  js.Var("w",  ee.watts);
-  js.Var("r",  ee.rate);
-  js.Var("e",  ee.bEco);
-  js.Var("season", display.m_season);
-  IPAddress hip(ee.hostIP);
-  IPAddress lip(ee.lightIP[0]);
-  IPAddress fip(ee.lightIP[1]);
+  js.Var("idx", ss.idx);
+  js.Array("cnt", ss.schedCnt, 4);
+  js.Var("season", ss.season);
+  IPAddress hip(ss.hostIP);
+  IPAddress lip(ss.lightIP);
+  IPAddress fip(ss.fanIP);
   js.Var("hip", hip.toString());
   js.Var("lip", lip.toString());
   js.Var("fip", fip.toString());
-  js.Array("item", ee.schedule, 4);
-  js.Array("seasonDays", ee.scheduleDays, 4);
-  js.Array("ts", ee.tSecsMon, 12);
+  js.Array("seasonDays", ss.scheduleDays, 4);
+  js.Array("ts", ss.tSecsMon, 12);
+  return js.Close();
+}
+
+uint8_t schedCount(uint8_t season) // any task
+{
+  schedSnap ss;
+  schedLock.read(ss);
+  return ss.cnt[season];
+}
+
+String schedJson(uint8_t season, uint8_t start) // one page of a season's schedule, any task
+{
+  schedSnap ss;
+  schedLock.read(ss);
+
+  jsonString js("sched");
+  uint8_t cnt = ss.cnt[season];
+  uint8_t first = 0;
+
+  for (uint8_t s = 0; s < season; s++)
+    first += ss.cnt[s];
+  if (start > cnt)
+    start = cnt;
+  js.Var("season", season);
+  js.Var("start", start);
+  js.Var("cnt", cnt);
+  js.Array("item", &ss.item[first + start], min(cnt - start, SCHED_PAGE));
   return js.Close();
 }
 
+void sendSchedChg() // one broadcast of the edited season(s) after all commands are applied
+{
+  if (nSchedChg < 0)
+    return;
+  publishState(); // the pages come from the snapshot
+  for (uint8_t s = 0; s < 4; s++)
+  {
+    if (nSchedChg != SCHED_ALL && nSchedChg != s)
+      continue;
+    for (uint8_t i = 0; i < schedCount(s); i += SCHED_PAGE)
+      topics.publish(TP_SET, schedJson(s, i), true);
+  }
+  journal.add(JE_SET, nSchedChg);
+  nSchedChg = -1;
+}
+
+// Commands that do something, key first.  The settings from settings.h follow
+#define ACTIONS(X) \
+  X(key) X(oled) X(cnt) X(tadj) X(I) X(N) X(S) X(T) X(H) X(vibe) X(dot) X(save) X(aadj) \
+  X(outtemp) X(outrh) X(notif) X(notifCancel) X(hostip) X(lightip) X(music) X(send) X(restart) \
+  X(sea) X(D) X(sched)
+
+#define CI_ACTION(n) CI_##n,
+#define CI_SETTING(t, m, d, c, j, k, lo, hi, fn) CI_##m,
+enum cmdIdx
+{
+  ACTIONS(CI_ACTION)
+  SETTINGS(CI_SETTING)
+  CI_CNT
+};
+
+#define NAME_ACTION(n) #n,
+#define NAME_SETTING(t, m, d, c, j, k, lo, hi, fn) c,
 const char *jsonListCmd[] = {
-  "key",
-  "oled",
-  "TZ",
-  "avg",
-  "cnt",
-  "tadj",
-  "ppkwh",
-  "vaca",
-  "vacatemp",
-  "I",
-  "N", // 10
-  "S",
-  "T",
-  "H",
-  "vibe",
-  "watts",
-  "dot",
-  "save",
-  "aadj",
-  "eco",
-  "outtemp", // 20
-  "outrh",
-  "notif",
-  "notifCancel",
-  "rate",
-  "hostip",
-  "lightip",
-  "music",
-  "send",
-  "restart",
+  ACTIONS(NAME_ACTION)
+  SETTINGS(NAME_SETTING)
   NULL
 };
 
+// Web parameter lookup, a collision free hash of the names.  The seed is found at boot
+#define CMD_HASH 128  // slots, power of 2
+#define CMD_NOHASH 0xFFFF // cmdSeed when no seed fits, cmdFind() scans the list
+
+uint8_t cmdHash[CMD_HASH]; // jsonListCmd index + 1, 0 = unused
+uint16_t cmdSeed;
+
+uint8_t cmdHashOf(const char *p, uint16_t seed)
+{
+  uint32_t h = 2166136261 ^ seed; // FNV-1a
+
+  while (*p)
+  {
+    h ^= (uint8_t)*p++;
+    h *= 16777619;
+  }
+  return (h ^ (h >> 16)) & (CMD_HASH - 1);
+}
+
+bool cmdHashInit() // before the server starts, cmdFind() is called from its task
+{
+  for (cmdSeed = 0; cmdSeed < CMD_NOHASH; cmdSeed++)
+  {
+    uint8_t i;
+
+    memset(cmdHash, 0, sizeof(cmdHash));
+    for (i = 0; i < CI_CNT; i++)
+    {
+      uint8_t h = cmdHashOf(jsonListCmd[i], cmdSeed);
+      if (cmdHash[h])
+        break;
+      cmdHash[h] = i + 1;
+    }
+    if (i == CI_CNT)
+      return true;
+  }
+  return false; // too many commands for CMD_HASH
+}
+
+int8_t cmdFind(const char *pName) // jsonListCmd index, -1 if unknown
+{
+  if (cmdSeed == CMD_NOHASH)
+  {
+    for (uint8_t i = 0; i < CI_CNT; i++)
+      if (!strcmp(jsonListCmd[i], pName))
+        return i;
+    return -1;
+  }
+
+  uint8_t i = cmdHash[cmdHashOf(pName, cmdSeed)];
+
+  if (i && !strcmp(jsonListCmd[i - 1], pName))
+    return i - 1;
+  return -1;
+}
+
+
+// Web commands are queued by the server's task and applied by loop(), the only writer of the state
+#define CMD_BATCH  24    // commands in one request
+#define CMD_RESERVE 16   // queue room only websocket client events can use, a lost one would leak a topics slot
+#define CMD_PUSH   0x80  // + jsonListPush index, replies from other devices
+#define CMD_WSCONN 0xFC  // websocket client events, ip = client id
+#define CMD_WSDISC 0xFD
+#define CMD_SUB    0xFE  // pValue = topic list
+#define CMD_END    0xFF  // last of a batch, iValue = CE_ flags
+
+#define CE_SET     1     // send the settings to all pages after
+
+struct cmdMsg
+{
+  uint8_t  cmd;     // jsonListCmd index, or CMD_
+  int32_t  iValue;
+  uint32_t ip;      // sender
+  char    *pValue;  // heap copy, NULL if empty
+};
+
+MpscQueue<cmdMsg, 64> cmdQueue;
+cmdMsg cmdBatch[CMD_BATCH + 1]; // being filled by the web server
+uint8_t cmdCnt;
 bool bKeyGood;
+bool bKeyFail; // counted once per request
+
+void cmdAdd(uint8_t cmd, int iValue, const char *psValue)
+{
+  if (cmdCnt >= CMD_BATCH)
+    return;
+  cmdMsg &m = cmdBatch[cmdCnt++];
+  m.cmd = cmd;
+  m.iValue = iValue;
+  m.ip = lastIP;
+  m.pValue = (psValue && *psValue) ? strdup(psValue) : NULL;
+}
 
-void parseParams(AsyncWebServerRequest *request)
+bool cmdSend(uint8_t flags) // false if the queue was full and the request dropped
 {
-  int16_t val;
+  cmdMsg &m = cmdBatch[cmdCnt++];
+  m.cmd = CMD_END;
+  m.iValue = flags;
+  m.pValue = NULL;
+
+  bool bOk = cmdQueue.push(cmdBatch, cmdCnt, CMD_RESERVE);
+  if (!bOk) // full, drop the whole request
+    for (uint8_t i = 0; i < cmdCnt; i++)
+      free(cmdBatch[i].pValue);
+  tasks.wake();
+  cmdCnt = 0;
+  return bOk;
+}
 
-  if (nWrongPass && request->client()->remoteIP() != lastIP) // if different IP drop it down
-    nWrongPass = 10;
+void wsPost(uint8_t cmd, uint32_t id, const char *psValue) // websocket client events for loop()
+{
+  cmdMsg m;
+
+  m.cmd = cmd;
+  m.iValue = 0;
+  m.ip = id;
+  m.pValue = psValue ? strdup(psValue) : NULL;
+  if (!cmdQueue.push(&m))
+    free(m.pValue);
+  tasks.wake();
+}
 
+bool parseParams(AsyncWebServerRequest *request) // false if the client was refused (already answered)
+{
   lastIP = request->client()->remoteIP();
+  if (!clientLimit.allow(lastIP, millis())) // before anything is decoded
+  {
+    request->send(429);
+    return false;
+  }
+
+  bKeyGood = false;
+  bKeyFail = false;
 
   for ( uint8_t i = 0; i < request->params(); i++ )
   {
     AsyncWebParameter* p = request->getParam(i);
     String s = request->urlDecode(p->value());
 
-    uint8_t idx;
-    for (idx = 0; jsonListCmd[idx]; idx++)
-      if ( p->name().equals(jsonListCmd[idx]) )
-        break;
-    if (jsonListCmd[idx] == NULL)
-      return;
+    int8_t idx = cmdFind(p->name().c_str());
+    if (idx < 0)
+      break;
     int iValue = s.toInt();
     if (s == "true") iValue = 1;
 
     jsonCallback(idx, iValue, (char *)s.c_str());
   }
+  bool bCmds = (cmdCnt > 0);
+  if (!cmdSend(0) && bCmds) // dropped, don't say it worked
+  {
+    request->send(503);
+    return false;
+  }
+  return true;
 }
 
+// the key is checked here, everything else is applied in loop()
 void jsonCallback(int16_t iName, int iValue, char *psValue)
 {
-  if (!bKeyGood && iName)
+  if (iName == CI_key)
   {
-    if (nWrongPass == 0)
-      nWrongPass = 10;
-    else if ((nWrongPass & 0xFFFFF000) == 0 ) // time doubles for every high speed wrong password attempt.  Max 1 hour
-      nWrongPass <<= 1;
+    if (!strcmp(psValue, controlPassword)) // first item must be key
+    {
+      bKeyGood = true;
+      clientLimit.authOk(lastIP);
+      cmdAdd(CI_key, 0, NULL);
+      return;
+    }
+  }
+  if (!bKeyGood)
+  {
+    if (!bKeyFail) // locked out for a while, longer with each one
+      clientLimit.authFail(lastIP, millis());
+    bKeyFail = true;
     return; // only allow for key
   }
+  cmdAdd(iName, iValue, psValue);
+}
+
+bool bSetChg; // settings changed by the last commands
+
+int settingVal(uint8_t kind, int iValue, const char *psValue, int lo, int hi)
+{
+  if (kind == SK_TENTHS)
+    iValue = (int)(atof(psValue) * 10);
+  else if (kind == SK_BOOL)
+    iValue = iValue ? 1 : 0;
+  return constrain(iValue, lo, hi);
+}
+
+void applyCmd(uint8_t iName, int iValue, char *psValue, IPAddress ip)
+{
   char *p, *p2;
   static int item = 0;
+  static uint8_t season;
 
   switch (iName)
   {
-    case 0: // key
-      if (!strcmp(psValue, controlPassword)) // first item must be key
-        bKeyGood = true;
+    case CI_key: // key (already checked)
+      season = display.m_season; // edit the active season unless "sea" is sent
       break;
-    case 1: // OLED
+    case CI_oled:
       display.screen(true);
       break;
-    case 2: // TZ
-      ee.tz = iValue;
-      udptime.start();
-      break;
-    case 3: // avg
-      ee.bAvg = iValue;
-      break;
-    case 4: // cnt
-      ee.schedCnt[display.m_season] = constrain(iValue, 1, 8);
-      ws.textAll(setJson()); // update all the entries
+    case CI_cnt:
+      if (season == SCHED_ALL) break;
+      sched.setCount(season, constrain(iValue, 1, MAX_SCHED)); // before it's narrowed
+      checkSched(true);
+      nSchedChg = season;
+      bSetChg = true; // update all the entries
       break;
-    case 5: // tadj
+    case CI_tadj:
       changeTemp(iValue, false);
-      ws.textAll(setJson()); // update all the entries
+      nSchedChg = display.m_season;
+      bSetChg = true; // update all the entries
       break;
-    case 6: // ppkw
-      ee.ppkwh = iValue;
+    case CI_I:
+      if (season == SCHED_ALL) break;
+      item = constrain(iValue, 0, sched.count(season) - 1);
       break;
-    case 7: // vaca
-      ee.bVaca = iValue;
-      break;
-    case 8: // vacatemp
-      if (bCF)
-        ee.vacaTemp = constrain( (int)(atof(psValue) * 10), 100, 290); // 10-29C
-      else
-        ee.vacaTemp = constrain( (int)(atof(psValue) * 10), 600, 840); // 60-84F
+    case CI_N:
       break;
-    case 9: // I
-      item = iValue;
-      break;
-    case 10: // N
-      break;
-    case 11: // S
+    case CI_S:
+      if (season == SCHED_ALL) break;
       p = strtok(psValue, ":");
       p2 = strtok(NULL, "");
       if (p && p2) {
-        iValue *= 60;
-        iValue += atoi(p2);
+        int m = atoi(p2);
+        if (iValue < 0 || m < 0 || m > 59)
+        {
+          sendAlert("Invalid time");
+          break;
+        }
+        iValue = iValue * 60 + m;
+      }
+      if (iValue < 0)
+      {
+        sendAlert("Invalid time");
+        break;
       }
-      ee.schedule[display.m_season][item].timeSch = iValue;
+      sched.item(season, item).timeSch = iValue % (24 * 60);
+      checkSched(true);   // resort
+      nSchedChg = season;
       break;
-    case 12: // T
-      ee.schedule[display.m_season][item].setTemp = atof(psValue) * 10;
+    case CI_T:
+      if (season == SCHED_ALL) break;
+      sched.item(season, item).setTemp = constrain((int)(atof(psValue) * 10), bCF ? 155 : 600, bCF ? 322 : 900);
+      nSchedChg = season;
       break;
-    case 13: // H
-      ee.schedule[display.m_season][item].thresh = (int)(atof(psValue) * 10);
+    case CI_H:
+      if (season == SCHED_ALL) break;
+      sched.item(season, item).thresh = constrain((int)(atof(psValue) * 10), 1, 100);
       checkLimits();      // constrain and check new values
       checkSched(true);   // reconfigure to new schedule
+      nSchedChg = season;
       break;
-    case 14: // vibe (vibe period)
-      break;
-    case 15: // watts
-      ee.watts = iValue;
+    case CI_vibe: // vibe (vibe period)
       break;
-    case 16: // dot displayOnTimer
+    case CI_dot: // dot displayOnTimer
       if (iValue)
         display.screen(true);
       break;
-    case 17: // save
+    case CI_save:
       updateAll(true);
       break;
-    case 18: // aadj
+    case CI_aadj:
       changeTemp(iValue, true);
-      ws.textAll(setJson()); // update all the entries
-      break;
-    case 19: // eco
-      ee.bEco = iValue ? true : false;
-      setHeat();
+      nSchedChg = display.m_season;
+      bSetChg = true; // update all the entries
       break;
-    case 20: // outtemp
+    case CI_outtemp:
       display.m_outTemp = iValue;
       break;
-    case 21: // outrh
+    case CI_outrh:
       display.m_outRh = iValue;
       break;
-    case 22: // notif
-      display.Notification(psValue, lastIP);
+    case CI_notif:
+      display.Notification(psValue, ip);
+      journal.add(JE_NOTIF, 1, psValue);
       break;
-    case 23: // notifCancel
+    case CI_notifCancel:
       display.NotificationCancel(psValue);
+      journal.add(JE_NOTIF, 0, psValue);
       break;
-    case 24: // rate
-      if (iValue == 0)
-        break; // don't allow 0
-      ee.rate = iValue;
-      sendState();
-      break;
-    case 25: // host IP / port  (call from host with ?h=80)
-      ee.hostIP[0] = lastIP[0];
-      ee.hostIP[1] = lastIP[1];
-      ee.hostIP[2] = lastIP[2];
-      ee.hostIP[3] = lastIP[3];
+    case CI_hostip: // host IP / port  (call from host with ?h=80)
+      ee.hostIP[0] = ip[0];
+      ee.hostIP[1] = ip[1];
+      ee.hostIP[2] = ip[2];
+      ee.hostIP[3] = ip[3];
       ee.hostPort = iValue ? iValue : 80;
       break;
-    case 26: // lightIP
+    case CI_lightip:
       {
         IPAddress ip;
         ip.fromString(psValue);
@@ -397,27 +790,74 @@ void jsonCallback(int16_t iName, int iValue, char *psValue)
         ee.lightIP[0][1] = ip[1];
         ee.lightIP[0][2] = ip[2];
         ee.lightIP[0][3] = ip[3];
+        connectRemote(0);
       }
       break;
-    case 27: // music
+    case CI_music:
       mus.play(iValue);
       break;
-    case 28: // send
+    case CI_send:
       bTxTemp = iValue ? true : false;
       break;
-    case 29: // restart
+    case CI_restart:
 #ifdef ESP32
       ESP.restart();
 #else
       ESP.reset();
 #endif
       break;
+    case CI_sea: // sea (season to edit, 4=all for sched)
+      season = constrain(iValue, 0, SCHED_ALL);
+      if (season == SCHED_ALL) // only valid for sched
+        break;
+      if (item >= sched.count(season))
+        item = 0;
+      break;
+    case CI_D: // D (weekday bits for item)
+      if (season == SCHED_ALL) break;
+      sched.item(season, item).wday = iValue & 0x7F;
+      checkSched(true);
+      nSchedChg = season;
+      break;
+    case CI_sched: // sched (whole season [[time,temp,thresh,wday],...] or all seasons [[[...]],[[...]],[[...]],[[...]]] with sea=4)
+      if (sched.load(season, psValue, bCF ? 155 : 600, bCF ? 322 : 900))
+      {
+        checkSched(true); // recompile once
+        nSchedChg = season;
+      }
+      else
+        sendAlert("Invalid schedule");
+      break;
+#define CMD_SETTING(t, m, d, c, j, k, lo, hi, fn) \
+    case CI_##m: \
+      ee.m = settingVal(k, iValue, psValue, lo, hi); \
+      fn; \
+      break;
+    SETTINGS(CMD_SETTING)
+  }
+}
+
+// a page from pages.h, or 304 if the browser has this one
+void sendGz(AsyncWebServerRequest *request, const char *pType, const uint8_t *pData, size_t len, const char *pETag, const char *pCache)
+{
+  AsyncWebServerResponse *response;
+
+  if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == pETag)
+    response = request->beginResponse(304);
+  else
+  {
+    response = request->beginResponse_P(200, pType, pData, len);
+    response->addHeader("Content-Encoding", "gzip");
   }
+  response->addHeader("ETag", pETag);
+  response->addHeader("Cache-Control", pCache);
+  request->send(response);
 }
 
 void handleS(AsyncWebServerRequest *request) // standard params, but no page
 {
-  parseParams(request);
+  if (!parseParams(request))
+    return;
 
   jsonString js;
   String s = WiFi.localIP().toString() + ":";
@@ -434,72 +874,117 @@ const char *jsonListPush[] = {
   NULL
 };
 
-void jsonPushCallback(int16_t iName, int iValue, char *psValue)
+void jsonPushCallback(int16_t iName, int iValue, char *psValue) // replies, queued for loop()
+{
+  cmdMsg m;
+
+  m.cmd = CMD_PUSH + iName;
+  m.iValue = iValue;
+  m.ip = 0;
+  m.pValue = NULL;
+  cmdQueue.push(&m, 1, CMD_RESERVE);
+  tasks.wake();
+}
+
+void applyPush(int16_t iName, int iValue)
 {
   switch (iName)
   {
     case 0: // time
       if (iValue < now() + ((ee.tz + udptime.getDST()) * 3600) )
         break;
-      setTime(iValue + ( (ee.tz + udptime.getDST() ) * 3600));
+      setTime(iValue + ( (ee.tz + udptime.getDST() ) * 3600)); // a step is handled by wallClock
       break;
-    case 1: // ppkw
-      ee.ppkwh = iValue;
+    case 1: // ppkw, with the ppkwh command's range
+      {
+        static char szNone[1];
+        applyCmd(CI_ppkwh, iValue, szNone, IPAddress());
+      }
       break;
-    case 2: // on
+    case 2: // on (from the dimmer)
       display.m_bLightOn = iValue ? true : false;
+      devCache.report(DC_LIGHT_PWR, iValue ? 1 : 0, millis());
       break;
     case 3: // level
       display.updateLevel(iValue);
+      devCache.report(DC_LIGHT_LVL, iValue, millis());
       break;
   }
 }
 
-struct cQ
+void sendSnapshot(uint32_t id, bool bAll) // settings and schedules, and history with bAll
 {
-  IPAddress ip;
-  String sUri;
-  uint16_t port;
-};
-#define CQ_CNT 16
-cQ queue[CQ_CNT];
-uint8_t qI;
+  topics.sendTo(id, respCache.get(RC_SET));
+  for (uint8_t s = 0; s < 4; s++)
+    for (uint8_t i = 0; i < schedCount(s); i += SCHED_PAGE)
+      topics.sendTo(id, schedJson(s, i));
+  if (bAll)
+    topics.sendTo(id, respCache.get(RC_HIST));
+}
 
-void checkQueue()
+void wsResume(uint32_t id, char *psValue) // "boot,seq" the client has seen
 {
-  if (WiFi.status() != WL_CONNECTED)
-    return;
-
-  static uint8_t qIdx;
-
-  if (qIdx == qI || queue[qIdx].port == 0) // Nothing to do
-    return;
+  uint32_t boot = strtoul(psValue, &psValue, 10);
+  uint32_t seq = (*psValue == ',') ? strtoul(psValue + 1, NULL, 10) : 0;
 
-  if ( jsonPush.begin(queue[qIdx].ip, queue[qIdx].sUri.c_str(), queue[qIdx].port, false, false, NULL, NULL, 1) )
+  switch (journal.resume(id, boot, seq))
   {
-    jsonPush.setList(jsonListPush);
-    queue[qIdx].port = 0;
-    if (++qIdx >= CQ_CNT)
-      qIdx = 0;
+    case JR_SET:
+      sendSnapshot(id, false);
+      break;
+    case JR_FULL:
+      sendSnapshot(id, true);
+      break;
   }
+  topics.sendTo(id, journal.headJson());
 }
 
-void callQueue(IPAddress ip, String sUri, uint16_t port)
+void applyCmds() // loop()
 {
-  if (queue[qI].port == 0)
+  static char szNone[1];
+  cmdMsg m;
+
+  while (cmdQueue.pop(m))
   {
-    queue[qI].ip = ip;
-    queue[qI].sUri = sUri;
-    queue[qI].port = port;
+    if (m.cmd == CMD_END)
+    {
+      if (bSetChg || (m.iValue & CE_SET))
+      {
+        publishState();
+        topics.publish(TP_SET, respCache.get(RC_SET), true); // update all the entries
+      }
+      bSetChg = false;
+      sendSchedChg();
+    }
+    else if (m.cmd == CMD_WSCONN)
+    {
+      topics.connect(m.ip);
+      wsResume(m.ip, m.pValue ? m.pValue : szNone);
+    }
+    else if (m.cmd == CMD_WSDISC)
+      topics.disconnect(m.ip);
+    else if (m.cmd == CMD_SUB)
+    {
+      uint8_t added = topics.subscribe(m.ip, m.pValue ? m.pValue : szNone);
+      if (added & (1 << TP_STATE)) // send the current ones
+        topics.sendTo(m.ip, respCache.get(RC_STATE));
+      if (added & (1 << TP_SET))
+        topics.sendTo(m.ip, respCache.get(RC_SET));
+      if (added & (1 << TP_HIST))
+        topics.sendTo(m.ip, respCache.get(RC_HIST));
+    }
+    else if (m.cmd >= CMD_PUSH)
+      applyPush(m.cmd - CMD_PUSH, m.iValue);
+    else
+      applyCmd(m.cmd, m.iValue, m.pValue ? m.pValue : szNone, IPAddress(m.ip));
+    free(m.pValue);
   }
-
-  if (++qI >= CQ_CNT)
-    qI = 0;
 }
 
 void CallHost(reportReason r)
 {
-  if (ee.hostIP[0] == 0) // no host set
+  IPAddress ip = peers.ip(PEER_HOST);
+  if (ip[0] == 0) // no host set
     return;
 
   uriString uri("/wifi");
@@ -517,13 +1002,89 @@ void CallHost(reportReason r)
       break;
   }
 
-  IPAddress ip(ee.hostIP);
-  callQueue(ip, uri.string(), ee.hostPort);
+  callQueue.add(ip, uri.string(), ee.hostPort, (r == Reason_Setup) ? CQ_HOST : CQ_NONE);
+}
+
+WebSocketsClient wsc[2]; // 0 = dimmer, 1 = fan
+bool bWscConnected[2];
+
+void remoteCallback(int16_t iName, int iValue, char *psValue);
+JsonParse remoteParse(remoteCallback);
+
+const char *jsonListRemote[] = {
+  "on", // 0
+  "level",
+  NULL
+};
+
+void remoteCallback(int16_t iName, int iValue, char *psValue) // state pushed from the dimmer
+{
+  switch (iName)
+  {
+    case 0: // on
+      display.m_bLightOn = iValue ? true : false;
+      devCache.report(DC_LIGHT_PWR, iValue ? 1 : 0, millis());
+      break;
+    case 1: // level
+      display.updateLevel(iValue);
+      devCache.report(DC_LIGHT_LVL, iValue, millis());
+      break;
+  }
+}
+
+void fanCallback(int16_t iName, int iValue, char *psValue) // state pushed from the fan
+{
+  if (iName == 0) // on
+    devCache.report(DC_FAN_PWR, iValue ? 1 : 0, millis());
+}
+
+JsonParse fanParse(fanCallback);
+
+// send a command on the open connection, false if it has to go over http
+bool remoteSend(uint8_t dev, const char *pName, int iValue)
+{
+  if (!bWscConnected[dev])
+    return false;
+  jsonString js;
+  js.Var("key", controlPassword);
+  js.Var(pName, iValue);
+  String s = js.Close();
+  return wsc[dev].sendTXT(s);
 }
 
 void LightSwitch(uint8_t t, uint8_t v)
 {
-  if (ee.lightIP[0][0] == 0)
+  if (!t)
+    v = v ? 1 : 0;
+  if (devCache.want(t ? DC_LIGHT_LVL : DC_LIGHT_PWR, v, millis()))
+    lightSend(t, v);
+}
+
+void FanSwitch(uint8_t v)
+{
+  if (devCache.want(DC_FAN_PWR, v ? 1 : 0, millis()))
+    fanSend(v ? 1 : 0);
+}
+
+void devReconcile() // resend what the devices haven't confirmed
+{
+  int8_t ch;
+
+  while ((ch = devCache.reconcile(millis())) >= 0)
+  {
+    if (ch == DC_FAN_PWR)
+      fanSend(devCache.wanted(ch));
+    else
+      lightSend(ch == DC_LIGHT_LVL, devCache.wanted(ch));
+  }
+}
+
+void lightSend(uint8_t t, uint8_t v)
+{
+  IPAddress ip = peers.ip(PEER_DIMMER);
+  if (ip[0] == 0)
+    return;
+  if (remoteSend(0, t ? "level" : "pwr", v))
     return;
   uriString uri("/wifi");
   uri.Param("key", controlPassword);
@@ -536,50 +1097,101 @@ void LightSwitch(uint8_t t, uint8_t v)
       uri.Param("level", v);
       break;
   }
-  IPAddress ip(ee.lightIP[0]);
-  callQueue(ip, uri.string(), 80);
+  callQueue.add(ip, uri.string(), 80, t ? CQ_LIGHT_LVL : CQ_LIGHT_PWR); // only the latest state is sent
 }
 
-void FanSwitch(uint8_t v)
+void fanSend(uint8_t v)
 {
-  if (ee.lightIP[1][0] == 0)
+  IPAddress ip = peers.ip(PEER_FAN);
+  if (ip[0] == 0)
+    return;
+  if (remoteSend(1, "pwr", v))
     return;
   uriString uri("/wifi");
   uri.Param("key", controlPassword);
   uri.Param("pwr", v);
-  IPAddress ip(ee.lightIP[1]);
 
-  callQueue(ip, uri.string(), 80);
+  callQueue.add(ip, uri.string(), 80, CQ_FAN);
 }
 
-WebSocketsClient wsc;
-bool bWscConnected;
+void connectRemote(uint8_t dev)
+{
+  if (dev)
+    devCache.forget(DC_FAN_PWR);
+  else
+  {
+    devCache.forget(DC_LIGHT_PWR);
+    devCache.forget(DC_LIGHT_LVL);
+  }
+  if (bWscConnected[dev])
+    wsc[dev].disconnect();
+  bWscConnected[dev] = false;
+  IPAddress ip = peers.ip(dev ? PEER_FAN : PEER_DIMMER);
+  if (ip[0] == 0)
+    return;
+  wsc[dev].onEvent([dev](WStype_t type, uint8_t * payload, size_t length) {
+    webSocketEvent(dev, type, payload, length);
+  });
+  wsc[dev].setReconnectInterval(5000);
+  wsc[dev].enableHeartbeat(15000, 3000, 2); // drop a dead link so it reconnects
+  wsc[dev].begin(ip, 80, "/ws");
+}
 
-void connectDimmer()
+void peerChanged(uint8_t peer) // new address found
 {
-  wsc.onEvent(webSocketEvent);
-  IPAddress ip(ee.lightIP[0]);
-  wsc.begin(ip, 80, "/ws");
+  switch (peer)
+  {
+    case PEER_DIMMER:
+      connectRemote(0);
+      break;
+    case PEER_FAN:
+      connectRemote(1);
+      break;
+  }
 }
 
-void webSocketEvent(WStype_t type, uint8_t * payload, size_t length)
+void webSocketEvent(uint8_t dev, WStype_t type, uint8_t * payload, size_t length)
 {
   switch (type)
   {
     case WStype_DISCONNECTED:
-      bWscConnected = false;
+      bWscConnected[dev] = false;
       break;
     case WStype_CONNECTED:
-      bWscConnected = true;
+      bWscConnected[dev] = true;
       break;
     case WStype_TEXT:
-      {
-        // remoteParse.process((char*)data);
-      }
+      if (dev == 0)
+        remoteParse.process((char*)payload);
+      else
+        fanParse.process((char*)payload);
       break;
   }
 }
 
+const char *jsonListSub[] = {
+  "sub",
+  NULL
+};
+
+uint32_t nSubClient;
+
+void subCallback(int16_t iName, int iValue, char *psValue)
+{
+  wsPost(CMD_SUB, nSubClient, psValue);
+}
+
+JsonParse subParse(subCallback);
+
+bool isSub(const char *p) // "sub" is the first key, not text in a command
+{
+  while (isspace(*p)) p++;
+  if (*p++ != '{')
+    return false;
+  while (isspace(*p)) p++;
+  return !strncmp(p, "\"sub\"", 5);
+}
+
 void onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t *data, size_t len)
 { //Handle WebSocket event
   static bool bRestarted = true;
@@ -587,19 +1199,35 @@ void onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventT
   switch (type)
   {
     case WS_EVT_CONNECT:      //client connected
-      if (bRestarted)
       {
-        bRestarted = false;
-        jsonString js("alert");
-        js.Var("data", "Restarted");
-        client->text(js.Close());
-      }
+        AsyncWebServerRequest *request = (AsyncWebServerRequest *)arg;
+        String sPos;
+
+        if (bRestarted)
+        {
+          bRestarted = false;
+          jsonString js("alert");
+          js.Var("data", "Restarted");
+          client->text(js.Close());
+        }
 
-      client->text(dataJson());
-      client->text(setJson());
-      client->text( ta.get() );
+        client->text(respCache.get(RC_STATE));
+        if (request && request->hasParam("boot") && request->hasParam("seq")) // /ws?boot=&seq= reconnect, loop() sends what it missed
+          sPos = request->getParam("boot")->value() + "," + request->getParam("seq")->value();
+        else
+        {
+          sPos = String(journal.boot()) + "," + String(journal.head()); // anything after this is sent by loop()
+          client->text(respCache.get(RC_SET));
+          for (uint8_t s = 0; s < 4; s++)
+            for (uint8_t i = 0; i < schedCount(s); i += SCHED_PAGE)
+              client->text(schedJson(s, i));
+          client->text( respCache.get(RC_HIST) );
+        }
+        wsPost(CMD_WSCONN, client->id(), sPos.c_str());
+      }
       break;
     case WS_EVT_DISCONNECT:    //client disconnected
+      wsPost(CMD_WSDISC, client->id(), NULL);
       break;
     case WS_EVT_ERROR:    //error was received from the other end
       break;
@@ -612,9 +1240,19 @@ void onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventT
         if (info->opcode == WS_TEXT) {
           data[len] = 0;
 
+          lastIP = client->remoteIP();
+          if (!clientLimit.allow(lastIP, millis())) // subscriptions too, they need no key
+            break;
+          if (isSub((char*)data)) // {"sub":"state,alert"} topics for this client, no key needed
+          {
+            nSubClient = client->id();
+            subParse.process((char*)data);
+            break;
+          }
           bKeyGood = false; // for callback (all commands need a key)
+          bKeyFail = false;
           jsonParse.process((char*)data);
-          ws.textAll(setJson()); // update the page settings
+          cmdSend(CE_SET); // update the page settings after
         }
       }
       break;
@@ -640,44 +1278,189 @@ void getSeason()
       display.m_season = 2;
 }
 
-void setup()
+// Startup runs in stages, one per loop(), with the heater sensors first so temperature
+// control doesn't wait for the network and display
+void bootSensors()
 {
-  Serial.begin(115200);
+  if ( ds.search(ds_addr) )
+  {
 #ifdef SDEBUG
-  delay(1000);
-  Serial.println();
-  Serial.println("Starting");
+    Serial.print("OneWire device: "); // 28 22 92 29 7 0 0 6B
+    for ( int i = 0; i < 8; i++) {
+      Serial.print(ds_addr[i], HEX);
+      Serial.print(" ");
+    }
+    Serial.println("");
+    if ( OneWire::crc8( ds_addr, 7) != ds_addr[7]) {
+      Serial.println("Invalid CRC");
+    }
 #endif
-  pinMode(MOTION, INPUT);
-  pinMode(TONE, OUTPUT);
-  digitalWrite(TONE, LOW);
-  pinMode(BTN, INPUT_PULLUP);
-  pinMode(HEAT, OUTPUT);
-  digitalWrite(HEAT, LOW);
+  }
+  else
+  {
+#ifdef SDEBUG
+    Serial.println("No OneWire devices");
+#endif
+  }
+
+  sht.init();
+  sensors.start(); // DS18 conversions and SHT21 reads from here on
+  checkSched(true); // targets from the schedule until the clock is set
 #ifdef ESP_LED
-  pinMode(ESP_LED, OUTPUT);
-  digitalWrite(ESP_LED, LOW);
+  digitalWrite(ESP_LED, HIGH);
 #endif
+}
 
-  ee.init();
+void bootWiFi()
+{
+  WiFi.persistent(false); // credentials are in ee
+  WiFi.setAutoReconnect(false); // checkWiFi() handles it
   WiFi.hostname(hostName);
   WiFi.mode(WIFI_STA);
+  wifiConnect(ee.channel ? WF_FAST : WF_SCAN);
+}
 
-  display.init();
+void wifiConnect(uint8_t state)
+{
+  IPAddress ip;
+
+  if (ee.szSSID[0] == 0)
+    state = WF_SMART;
 
-  if ( ee.szSSID[0] )
+  if (wifiState == WF_SMART && state != WF_SMART)
   {
-    WiFi.begin(ee.szSSID, ee.szSSIDPassword);
-    WiFi.setHostname(hostName);
-    bConfigDone = true;
+    WiFi.stopSmartConfig();
+    WiFi.mode(WIFI_STA);
   }
-  else
+  wifiState = state;
+
+  switch (state)
   {
-    IPAddress ip;
-    display.Notification("No SSID set\r\nWaiting for EspTouch", ip);
-    WiFi.beginSmartConfig();
+    case WF_FAST:
+    case WF_SCAN:
+      if (ee.bStaticIP)
+        WiFi.config(IPAddress(ee.ipCfg[0]), IPAddress(ee.ipCfg[1]), IPAddress(ee.ipCfg[2]), IPAddress(ee.ipCfg[3]));
+      else
+        WiFi.config(IPAddress(0,0,0,0), IPAddress(0,0,0,0), IPAddress(0,0,0,0)); // DHCP
+      if (state == WF_FAST)
+      {
+        WiFi.begin(ee.szSSID, ee.szSSIDPassword, ee.channel, ee.bssid);
+        wifiTimer.start(5000);
+      }
+      else
+      {
+        WiFi.begin(ee.szSSID, ee.szSSIDPassword);
+        wifiTimer.start(20000);
+      }
+      WiFi.setHostname(hostName);
+      break;
+    case WF_WAIT:
+      WiFi.disconnect();
+      wifiTimer.start(min(10 << min(wifiFails, (uint8_t)4), 120) * 1000); // 20s, 40s, 80s, 120s
+      break;
+    case WF_SMART:
+      display.Notification(ee.szSSID[0] ? "Connect Failed\r\nWaiting for EspTouch" : "No SSID set\r\nWaiting for EspTouch", ip);
+      WiFi.mode(WIFI_AP_STA);
+      WiFi.beginSmartConfig();
+      wifiTimer.start(180000); // then go back to the saved AP
+      break;
+  }
+}
+
+// once per second
+void checkWiFi()
+{
+  if (WiFi.status() == WL_CONNECTED)
+  {
+    if (wifiState != WF_CONNECTED)
+    {
+      wifiState = WF_CONNECTED;
+      wifiFails = 0;
+      saveWiFi();
+    }
+    if (!bStarted)
+    {
+      bStarted = true;
+      udptime.start();
+      MDNS.addService("iot", "tcp", serverPort);
+      peers.start(); // find the others in the background
+      updateAll(false);
+      connectRemote(0);
+      connectRemote(1);
+    }
+    return;
+  }
+
+  switch (wifiState)
+  {
+    case WF_CONNECTED: // lost it, try the same AP right away
+      wifiConnect(WF_FAST);
+      break;
+    case WF_SMART:
+      if (WiFi.smartConfigDone())
+      {
+        WiFi.mode(WIFI_STA);
+        WiFi.SSID().toCharArray(ee.szSSID, sizeof(ee.szSSID)); // Get the SSID from SmartConfig
+        WiFi.psk().toCharArray(ee.szSSIDPassword, sizeof(ee.szSSIDPassword) );
+        ee.channel = 0; // new AP
+        ee.bStaticIP = false;
+        wifiState = WF_SCAN;
+        wifiTimer.start(20000);
+      }
+      else if (ee.szSSID[0] && wifiTimer.expired())
+        wifiConnect(WF_FAST);
+      break;
+    default:
+      if (!wifiTimer.expired())
+        break;
+      switch (wifiState)
+      {
+        case WF_FAST: // AP may have moved channels
+          wifiConnect(WF_SCAN);
+          break;
+        case WF_SCAN:
+          // give the router a few minutes to come back before asking for a new one
+          wifiConnect(++wifiFails > 5 ? WF_SMART : WF_WAIT);
+          break;
+        case WF_WAIT:
+          wifiConnect(ee.channel ? WF_FAST : WF_SCAN);
+          break;
+      }
+      break;
+  }
+}
+
+// keep the AP and lease for the next connect
+void saveWiFi()
+{
+  memcpy(ee.bssid, WiFi.BSSID(), sizeof(ee.bssid));
+  ee.channel = WiFi.channel();
+  if (!ee.bStaticIP)
+  {
+    IPAddress ip[4] = {WiFi.localIP(), WiFi.gatewayIP(), WiFi.subnetMask(), WiFi.dnsIP()};
+    for (uint8_t i = 0; i < 4; i++)
+      for (uint8_t b = 0; b < 4; b++)
+        ee.ipCfg[i][b] = ip[i][b];
+  }
+  updateAll(false);
+}
+
+void bootDisplay()
+{
+  display.init();
+}
+
+void bootServer()
+{
+  jsonParse.setList(jsonListCmd);
+  subParse.setList(jsonListSub);
+  remoteParse.setList(jsonListRemote);
+  fanParse.setList(jsonListRemote);
+  if (!cmdHashInit())
+  {
+    Serial.println("No command hash seed, raise CMD_HASH");
+    sendAlert("No command hash seed, commands use a slow lookup");
   }
-  connectTimer = now();
 
 #ifdef USE_SPIFFS
   SPIFFS.begin();
@@ -688,52 +1471,32 @@ void setup()
   ws.onEvent(onWsEvent);
   server.addHandler(&ws);
 
-#ifdef ENABLE_HVAC_SENSOR
-  // Find HVAC
-  int cnt = MDNS.queryService("iot", "tcp");
-  for (int i = 0; i < cnt; ++i)
-  {
-    char szName[38];
-    MDNS.hostname(i).toCharArray(szName, sizeof(szName));
-    strtok(szName, "."); // remove .local
-
-    if (!strcmp(szName, "HVAC"))
-    {
-#ifdef ESP32
-      ee.hvacIP[0] = MDNS.address(i)[0]; // update IP
-      ee.hvacIP[1] = MDNS.address(i)[1];
-      ee.hvacIP[2] = MDNS.address(i)[2];
-      ee.hvacIP[3] = MDNS.address(i)[3];
-#else
-      ee.hvacIP[0] = MDNS.IP(i)[0]; // update IP
-      ee.hvacIP[1] = MDNS.IP(i)[1];
-      ee.hvacIP[2] = MDNS.IP(i)[2];
-      ee.hvacIP[3] = MDNS.IP(i)[3];
-#endif
-      break;
-    }
-  }
-#endif
-
   server.on ( "/", HTTP_GET, [](AsyncWebServerRequest * request)
   {
     // Send nothing
   });
   server.on ( "/iot", HTTP_GET | HTTP_POST, [](AsyncWebServerRequest * request )
   {
-    parseParams(request);
+    if (!parseParams(request))
+      return;
 #ifdef USE_SPIFFS
     request->send(SPIFFS, "/index.htm");
 #else
-    request->send_P(200, "text/html", index_page);
+    sendGz(request, "text/html", index_page, sizeof(index_page), INDEX_PAGE_ETAG, "no-cache");
 #endif
   });
   server.on ( "/s", HTTP_GET | HTTP_POST, handleS );
-  server.on ( "/set", HTTP_GET, [](AsyncWebServerRequest * request) {
-    request->send( 200, "text/json", setJson() );
+  server.on ( "/set", HTTP_GET, [](AsyncWebServerRequest * request) { // /set?sea=0&start=16 for a schedule page
+    if (request->hasParam("sea"))
+    {
+      uint8_t start = request->hasParam("start") ? request->getParam("start")->value().toInt() : 0;
+      request->send( 200, "text/json", schedJson(request->getParam("sea")->value().toInt() & 3, start) );
+    }
+    else
+      respCache.send(request, RC_SET);
   });
   server.on ( "/json", HTTP_GET, [](AsyncWebServerRequest * request) {
-    request->send( 200, "text/json", dataJson() );
+    respCache.send(request, RC_STATE);
   });
 
   server.onNotFound([](AsyncWebServerRequest * request) { // be silent
@@ -742,6 +1505,9 @@ void setup()
   server.on("/heap", HTTP_GET, [](AsyncWebServerRequest * request) {
     request->send(200, "text/plain", String(ESP.getFreeHeap()));
   });
+  server.on("/stats", HTTP_GET, [](AsyncWebServerRequest * request) {
+    request->send(200, "text/json", statsJson());
+  });
  /*
   server.on("/scan", HTTP_GET, [](AsyncWebServerRequest * request) {
     String json = "[";
@@ -774,9 +1540,7 @@ void setup()
 #ifdef USE_SPIFFS
     request->send(SPIFFS, "/favicon.ico");
 #else
-    AsyncWebServerResponse *response = request->beginResponse_P(200, "image/x-icon", favicon, sizeof(favicon));
-    response->addHeader("Content-Encoding", "gzip");
-    request->send(response);
+    sendGz(request, "image/x-icon", favicon, sizeof(favicon), FAVICON_ETAG, "max-age=86400");
 #endif
   });
 
@@ -785,8 +1549,11 @@ void setup()
   server.onRequestBody([](AsyncWebServerRequest * request, uint8_t *data, size_t len, size_t index, size_t total) {
   });
   server.begin();
+}
 
 #ifdef OTA_ENABLE
+void bootOTA()
+{
   ArduinoOTA.setHostname(hostName);
   ArduinoOTA.begin();
   ArduinoOTA.onStart([]() {
@@ -796,202 +1563,390 @@ void setup()
     updateAll( true );
     IPAddress ip;
     display.Notification("OTA Update Started", ip);
-  });
-#endif
-  jsonParse.setList(jsonListCmd);
-
-  if ( ds.search(ds_addr) )
-  {
-#ifdef SDEBUG
-    Serial.print("OneWire device: "); // 28 22 92 29 7 0 0 6B
-    for ( int i = 0; i < 8; i++) {
-      Serial.print(ds_addr[i], HEX);
-      Serial.print(" ");
-    }
-    Serial.println("");
-    if ( OneWire::crc8( ds_addr, 7) != ds_addr[7]) {
-      Serial.println("Invalid CRC");
-    }
-#endif
-  }
-  else
-  {
-#ifdef SDEBUG
-    Serial.println("No OneWire devices");
-#endif
-  }
-
-  sht.init();
-#ifdef ESP_LED
-  digitalWrite(ESP_LED, HIGH);
+  });
+}
 #endif
-  mus.add(2000, 50);
-  mus.add(5000, 100);
 
 #ifdef ESP32
+void bootRadar()
+{
+  RADAR_SERIAL.setRxBufferSize(1024); // bursts wait here between sensor task passes
   RADAR_SERIAL.begin(256000, SERIAL_8N1, RADAR_RX, RADAR_TX); //UART for monitoring the radar
 
   if(radar.begin(RADAR_SERIAL))
   {
     if(!radar.requestCurrentConfiguration())
       Serial.println("requestConfig failed");
+    if(!radar.requestStartEngineeringMode()) // per gate energies in every frame
+      Serial.println("engineering mode failed");
   }
   else
     Serial.println("radar.begin failed");
+  sensors.startRadar(&RADAR_SERIAL);
+}
+#endif
+
+struct bootStage
+{
+  const char *pName;
+  void (*fn)(void);
+  uint32_t us; // time taken
+};
+
+bootStage bootStages[] = {
+  {"sensors", bootSensors},
+  {"wifi", bootWiFi},
+  {"display", bootDisplay},
+  {"server", bootServer},
+#ifdef OTA_ENABLE
+  {"ota", bootOTA},
 #endif
+#ifdef ESP32
+  {"radar", bootRadar},
+#endif
+};
+#define BOOT_STAGES (sizeof(bootStages) / sizeof(bootStage))
+uint8_t bootIdx;
+uint32_t bootCtlMs; // millis() when the heater was first controlled
+
+bool bootNext() // run the next stage, returns true when all are done
+{
+  if (bootIdx >= BOOT_STAGES)
+    return true;
+  uint32_t us = micros();
+  bootStages[bootIdx].fn();
+  bootStages[bootIdx].us = micros() - us;
+  bootIdx++;
+  return false;
 }
 
-uint8_t ssCnt = 30;
-uint8_t nLightTimer;
+String statsJson()
+{
+  jsonString jsBoot;
+  for (uint8_t i = 0; i < BOOT_STAGES; i++)
+    jsBoot.Var(bootStages[i].pName, bootStages[i].us);
+  jsBoot.Var("ctlMs", bootCtlMs);
 
-#if defined(MOTION) && defined(ESP32)
+  jsonString js;
+  js.VarNoQ("boot", jsBoot.Close()); // stage times in us
+  js.VarNoQ("calls", callQueue.statsJson());
+  js.VarNoQ("devs", devCache.statsJson()); // sent, suppressed, resent, reports
+  js.VarNoQ("tasks", tasks.statsJson()); // runs, avg us, max us, max late ms
+  js.VarNoQ("sensors", sensors.statsJson());
+  js.Var("cmdDrop", (uint32_t)cmdQueue.m_drops);
+  js.VarNoQ("cache", respCache.statsJson()); // builds, hits, 304s
+  js.VarNoQ("ws", topics.statsJson()); // serialized, sent
+  js.VarNoQ("clients", clientLimit.statsJson());
+  js.VarNoQ("journal", journal.statsJson());
+  js.Array("presEv", presence.m_events, PE_CNT); // -, arrive, leave, in bed, out of bed
+  js.Array("presIn", presence.m_inputs, PI_CNT); // pir, radar, touch, button
+  js.Var("presFlaps", presence.m_flaps);
+  js.Var("clkSteps", wallClock.m_steps);
+  js.Var("lastStep", wallClock.m_lastStep);
+  return js.Close();
+}
 
-bool readRadar() // returns true if presence even while sleeping
+void setup()
 {
-  static bool bPresence;
-  static bool bInBed;
-  static uint16_t nLastDistance;
-  static uint16_t nDistArr[4];
-  static uint8_t idx;
+  Serial.begin(115200);
+#ifdef SDEBUG
+  delay(1000);
+  Serial.println();
+  Serial.println("Starting");
+#endif
+  pinMode(MOTION, INPUT);
+  pinMode(TONE, OUTPUT);
+  digitalWrite(TONE, LOW);
+  mus.init(); // starts the note timer
+  journal.begin(utcTime);
+  pinMode(BTN, INPUT_PULLUP);
+#ifdef ESP32
+  attachInterrupt(digitalPinToInterrupt(BTN), btnISR, CHANGE); // checkButtons() without waiting for the poll
+#endif
+  pinMode(HEAT, OUTPUT);
+  digitalWrite(HEAT, LOW);
+#ifdef ESP_LED
+  pinMode(ESP_LED, OUTPUT);
+  digitalWrite(ESP_LED, LOW);
+#endif
 
-  radar.read();
-  if(!radar.isConnected() || millis() - lastReading < 200) // 5 Hz
-    return bPresence;
+  ee.init();
+  peers.add(PEER_HVAC, peerName[PEER_HVAC], ee.hvacIP, &ee.hvacPort);
+  peers.add(PEER_DIMMER, peerName[PEER_DIMMER], ee.lightIP[0], NULL);
+  peers.add(PEER_FAN, peerName[PEER_FAN], ee.lightIP[1], NULL);
+  peers.add(PEER_HOST, peerName[PEER_HOST], ee.hostIP, &ee.hostPort);
+  peers.onChange(peerChanged);
+
+  respCache.add(RC_STATE, dataJson);
+  respCache.add(RC_SET, setJson);
+  respCache.add(RC_HIST, [](){ return ta.get(); }, true); // ta is only safe to read in loop()
+
+  tasks.add("clock", clockTask, 1000);
+  tasks.add("wifi", checkWiFi, 1000);
+  tasks.add("temp", checkTemp, 1000);
+  tasks.add("heat", heatTask, 1000);
+  tasks.add("display", [](){ display.oneSec(); }, 1000);
+  tasks.add("alarm", alarmTask, 1000);
+  tState = tasks.add("state", sendState, 30000);
+  tLight = tasks.add("light", [](){ LightSwitch(0, 0); });
+  tasks.add("devs", devReconcile, 5000);
+
+  bootNext(); // sensors
+  mus.add(2000, 50);
+  mus.add(5000, 100);
+}
 
-  lastReading = millis();
+void presenceEvent(uint8_t ev)
+{
+  if (ev == PE_NONE)
+    return;
+  journal.add(JE_PRESENCE, ev);
 
-  bPresence = radar.presenceDetected();
-  bool bStationary = false;
-  bool bMoving = false;
-  uint8_t nEnergy;
-  static uint16_t nDistance;
+  uint16_t f = prAction[ev].flags;
 
-  if(bPresence)
+  if (f & PA_LIGHT_STOP)
+    tasks.stop(tLight);
+  if (f & PA_LIGHT_WAIT)
+    tasks.start(tLight, PR_LIGHT_WAIT);
+  if (f & PA_SCREEN)
+    display.screen(true);
+  if (f & PA_LIGHT_ON)
   {
-    bStationary = radar.stationaryTargetDetected();
-    bMoving = radar.movingTargetDetected();
+    LightSwitch(0, 1);
+    display.m_bLightOn = true;
   }
+  if (f & PA_LIGHT_OFF)
+    LightSwitch(0, 0);
+  if (f & PA_FAN_ON)
+    FanSwitch(1);
+  if (f & PA_FAN_OFF)
+    FanSwitch(0);
+  if (prAction[ev].chimeMs)
+    mus.add(prAction[ev].chimeMs, 70);
 
-  if(bStationary && bMoving)
+  static bool bInBed;
+  if (presence.inBed() != bInBed) // out of bed or straight out of the room
   {
-    if( radar.movingTargetEnergy() >= radar.stationaryTargetEnergy())
-    {
-      if( radar.movingTargetDistance() )
-        nDistArr[idx++] = radar.movingTargetDistance();
-      nEnergy = radar.movingTargetEnergy();
-    }
-    else
-    {
-      if(radar.stationaryTargetDistance())
-        nDistArr[idx++] = radar.stationaryTargetDistance();
-      nEnergy = radar.stationaryTargetEnergy();
-    }
+    bInBed = presence.inBed();
+    topics.publish(TP_RADAR, bInBed ? "inBed 1" : "inBed 0", true);
   }
-  idx &= 3;
-  nDistance = 0;
+  if (f & PA_STATE)
+    sendState();
+}
 
-  for(uint8_t i = 0; i < 4; i++) // quick average. it bounces back and forth (person in and person out)
-    nDistance += nDistArr[i];
-  nDistance >>= 2;
+#if defined(MOTION) && defined(ESP32)
 
-  if(nDistance != nLastDistance || nEnergy)
-  {
-    nLastDistance = nDistance;
+String radarCapJson(radarSample &r) // one frame for tools/radarReplay
+{
+  uint32_t a[8 + LD_GATES * 2] = {r.ms, (uint32_t)(r.bMoving | (r.bStationary << 1)), r.detDist,
+    r.movDist, r.movEnergy, r.statDist, r.statEnergy, r.gates};
 
-    jsonString js("radar");
-    js.Var("presence", bPresence);
-    js.Var("distance", nDistance);
-    js.Var("energy", nEnergy);
-    ws.textAll(js.Close());
+  for(uint8_t g = 0; g < LD_GATES; g++)
+  {
+    a[8 + g] = r.movGate[g];
+    a[8 + LD_GATES + g] = r.statGate[g];
   }
+  jsonString js("rcap");
+  js.Array("f", a, 8 + LD_GATES * 2);
+  return js.Close();
+}
 
-  const uint16_t nBedRange = 195; // ~200cm from headboard to foot
+void readRadar() // feeds the occupancy classifier and presence
+{
+  radarSample r;
+  bool bNew = false;
 
-  static uint32_t nTimeout;
-  if( !bPresence && bInBed && nDistance < nBedRange/2) // no detection but last valid is within bed range
+  while(sensors.m_radarq.pop(r)) // every frame from the sensor task
   {
-    if(millis() - nTimeout < 90000)
-      bPresence = true;
+    bNew = true;
+    if(topics.wanted(TP_RADARCAP))
+      topics.publish(TP_RADARCAP, radarCapJson(r), true);
+    occ.add(r, ee.bedGates);
   }
-  else
+
+  if(!bNew)
+    return;
+
+  presence.radar(occ.cls(), millis());
+
+  if(topics.wanted(TP_RADAR))
   {
-    nTimeout = millis();
+    jsonString js("radar");
+    js.Var("presence", r.bPresence);
+    js.Var("distance", r.detDist);
+    js.Var("energy", max(r.movEnergy, r.statEnergy));
+    js.Var("occ", occ.name(occ.cls()));
+    js.Var("conf", occ.confidence());
+    js.Var("label", occ.name(occ.label()));
+    js.Var("latency", occ.latency());
+    js.Array("mov", r.movGate, r.gates);
+    js.Array("stat", r.statGate, r.gates);
+    topics.publish(TP_RADAR, js.Close(), false, r.detDist, r.bPresence | (occ.cls() << 1));
   }
+}
+#endif
+
+void sendHistory()
+{
+  static int32_t histCnt; // for a client's resolution, hist:0:4 is every fourth
+
+  if (!topics.wanted(TP_HIST))
+    return;
+  publishState(); // rebuilds it
+  topics.publish(TP_HIST, respCache.get(RC_HIST), false, ++histCnt);
+}
+
+// wall clock changes and the once a minute work
+void clockTask()
+{
+  static int8_t mon_save = -1;
+  uint8_t clk = wallClock.tick(now(), monoMs());
 
-  if( !bInBed && bPresence) // keep light on while out of bed
+  if (clk & WC_JUMP) // clock was set or stepped
   {
-    nLightTimer = 5;
+    getSeason();
+    checkSched(true);
+    alarms.update(now());
   }
 
-  if( !bInBed && bPresence && nDistance < nBedRange/2) // range moved to within bed
-  {
-    bInBed = true;
-    nLightTimer = 5;
-    FanSwitch(1);
+  if ((clk & WC_MINUTE) == 0)
+    return;
 
-    mus.add(3000, 70);
-    ws.textAll("inBed 1");
+  checkSched(false);     // check every minute for next schedule
+
+  if (clk & WC_HOUR)    // on the hour, or stepped over it
+  {
+    ta.add();
+    sendHistory();
+    if ( hour() == 2)     // update clock daily (at 2AM for DST)
+    {
+      udptime.start();
+      updateAll(false);    // update EEPROM daily
+    }
+    else if ( (hour() & 1) == 0) // even hour
+    {
+      updateAll(false);   // update EEPROM if changed
+    }
+    if ( mon_save != month() )
+    {
+      if (mon_save >= 0) // restart check
+        ee.tSecsMon[month() - 1] = 0;
+      mon_save = month();
+    }
+    CallHost(Reason_Setup);
+    getSeason();
+#ifdef ENABLE_HVAC_SENSOR
+    if (bTxTemp)
+      updateHvac(); // http hourly for time and ppkw
+#endif
   }
-  else if( bInBed && nDistance > nBedRange) // range moved outside bed
+  else if (clk & WC_HALF)
   {
-    bInBed = false;
-    nLightTimer = 0;
-    bMotion = false; // trigger lights on if someone gets out of bed (past the foot ususally, not the side)
-    display.screen(true);
-    LightSwitch(0, 1);
-    FanSwitch(0);
-    display.m_bLightOn = true;
-    mus.add(8000, 70);
-    ws.textAll("inBed 0");
+    ta.add(); // half hour log
+    sendHistory();
   }
-  else
+}
+
+void alarmTask()
+{
+  if (alarms.check(now(), display.m_bAlarmOn)) // single compare with the precomputed time
   {
-//    ws.textAll("else");
+    sendAlert("Alarm");
   }
+  alarms.service(); // make noise
+}
+
+// heater on time totals and eco cycling, once a second
+void heatTask()
+{
+  static bool bLastOn;
+  static uint16_t s = 1;
 
-  if(bPresence == false)
-    bInBed = false; // reset when gone
+  if (digitalRead(HEAT))
+    onCounter++;
+  else if (onCounter)
+  {
+    ee.tSecsMon[month() - 1] += onCounter;
+    onCounter = 0;
+  }
+  if (display.m_bHeater == false && nOvershootCnt)
+    nOvershootCnt++;
+  if (ee.bEco && display.m_bHeater) // eco mode
+  {
+    bBoost = (display.m_currentTemp < display.m_loTemp - ee.pids[2]); // 0.5 deg diff
+    if (bBoost == false)
+    {
+      if (--s == 0)
+      {
+        bool bOn = digitalRead(HEAT);
+        s = (bOn) ? ee.pids[0] : ee.pids[1]; // off 60 secs /on 180 secs (75%)
+        digitalWrite(HEAT, !bOn);
+      }
+    }
+  }
 
-  return bPresence;
+  if (display.m_bHeater != bLastOn || onCounter > (60 * 60 * 12)) // total up when it turns off or before 32 bit carry error
+  {
+    if (bLastOn)
+    {
+      updateAll( false );
+    }
+    bLastOn = display.m_bHeater;
+    ee.tSecsMon[month() - 1] += onCounter;
+    onCounter = 0;
+  }
+  if (display.m_bHeater)
+    nHeatCnt++;
+  else
+    nCoolCnt++;
 }
-#endif
 
 void loop()
 {
   static RunningMedian<uint16_t, 24> tempMedian[2];
-  static int8_t min_save, sec_save, mon_save = -1;
-  static bool bLastOn;
 
+  if (bootNext()) // networking and UI start after the heater is running
+  {
 #ifdef ESP8266
-  MDNS.update();
+    MDNS.update();
 #endif
 #ifdef OTA_ENABLE
-  ArduinoOTA.handle();
+    ArduinoOTA.handle();
 #endif
+  }
   checkButtons();
-  checkQueue();
+  if (WiFi.status() == WL_CONNECTED)
+  {
+    peers.service();
+    callQueue.service();
+  }
+  wsc[0].loop();
+  wsc[1].loop();
   if (display.checkNextion()) // check for touch, etc.
-    nAlarming = 0; // stop alarm
+  {
+    if (alarms.active()) // a touch while snoozed leaves the snooze alone
+      alarms.stop();
+    presence.activity(PI_TOUCH, millis());
+  }
 
   if (WiFi.status() == WL_CONNECTED)
-    if (udptime.check(ee.tz))
-    {
-      getSeason();
-      checkSched(true);  // initialize
-    }
+    udptime.check(ee.tz); // a clock change is picked up by wallClock
+
+  sensors.service();
 
-  if (sht.service())
+  shtSample sh;
+  if (sensors.m_shtq.pop(sh))
   {
     float newtemp, newrh;
     if (bCF)
-      newtemp = sht.getTemperatureC() * 10;
+      newtemp = sh.tempC * 10;
     else
-      newtemp = sht.getTemperatureF() * 10;
+      newtemp = sh.tempF * 10;
     newtemp += ee.tAdj[1]; // calibrated temp value
 
     tempMedian[0].add(newtemp);
     tempMedian[0].getAverage(2, newtemp);
-    tempMedian[1].add(sht.getRh() * 10);
+    tempMedian[1].add(sh.rh * 10);
     tempMedian[1].getAverage(2, newrh);
 
     if (display.m_roomTemp != newtemp)
@@ -1001,49 +1956,29 @@ void loop()
       sendState();
     }
 #ifdef ENABLE_HVAC_SENSOR
-    static int16_t oldTemp;
-    static uint32_t secs;
+    static uint16_t oldTemp, oldRh;
+    static MonoTimer heartbeat;
 
-    if ( (newtemp != oldTemp || now() - secs > 30 ) && WiFi.status() == WL_CONNECTED)
+    if ( (abs(display.m_roomTemp - oldTemp) >= TELEM_DEADBAND || abs(display.m_rh - oldRh) >= TELEM_RHBAND
+      || !heartbeat.running() || heartbeat.expired() ) && bTxTemp && WiFi.status() == WL_CONNECTED)
     {
-      oldTemp = newtemp;
-      secs = now();
-
-      if (bTxTemp)
-        updateHvac();
+      oldTemp = display.m_roomTemp;
+      oldRh = display.m_rh;
+      heartbeat.start(TELEM_INTERVAL * 1000);
+      sendTelemetry();
     }
 #endif
   }
 
 #ifdef MOTION
-
 #ifdef ESP32
-  if (readRadar() != bMotion)
-  {
-    bMotion = readRadar();
+  readRadar(); // the MOTION pin is the radar's own output here
 #else
-  if (digitalRead(MOTION) != bMotion)
-  {
-    bMotion = digitalRead(MOTION);
+  presence.pir(digitalRead(MOTION), millis());
 #endif
-    if(bMotion) // entered room
-    {
-      sendState();
-      display.screen(true);
-      LightSwitch(0, 1);
-      display.m_bLightOn = true;
-    }
-    else // left room
-    {
-      LightSwitch(0, 0);
-      FanSwitch(0);
-      sendState();
-    }
-  }
+  presenceEvent(presence.update(millis()));
 #endif
 
-  mus.service();
-
   switch (display.m_LightSet)
   {
     case 1: // light 1 on/off
@@ -1056,172 +1991,11 @@ void loop()
       break;
   }
 
-  if (sec_save != second()) // only do stuff once per second
-  {
-    sec_save = second();
-
-    if (!bConfigDone)
-    {
-      if ( WiFi.smartConfigDone())
-      {
-        WiFi.mode(WIFI_STA);
-        bConfigDone = true;
-        connectTimer = now();
-      }
-    }
-    if (bConfigDone)
-    {
-      if (WiFi.status() == WL_CONNECTED)
-      {
-        if (!bStarted)
-        {
-          bStarted = true;
-          udptime.start();
-          MDNS.addService("iot", "tcp", serverPort);
-          WiFi.SSID().toCharArray(ee.szSSID, sizeof(ee.szSSID)); // Get the SSID from SmartConfig or last used
-          WiFi.psk().toCharArray(ee.szSSIDPassword, sizeof(ee.szSSIDPassword) );
-          updateAll(false);
-          connectDimmer();
-        }
-        if (udptime.check(ee.tz))
-          checkSched(true);  // initialize
-      }
-      else if (now() - connectTimer > 10) // failed to connect for some reason
-      {
-        IPAddress ip;
-        display.Notification("Connect Failedr\r\nWaiting for EspTouch", ip);
-        connectTimer = now();
-        WiFi.mode(WIFI_AP_STA);
-        WiFi.beginSmartConfig();
-        bConfigDone = false;
-        bStarted = false;
-      }
-      else
-      {
-/*
-const char *szStat[] = {
-    "IDLE", "NO_SSID_AVAIL", "SCAN_COMPLETED", "CONNECTED", "CONNECT_FAILED", "CONNECTION_LOST", "DISCONNECTED"
-};
-
-        Serial.print( "WiFi " );
-        Serial.println( szStat[ WiFi.status()] );
-*/
-      }
-    }
-
-    checkTemp();
-
-    if (--ssCnt == 0)
-      sendState();
-
-    display.oneSec();
-
-    if (min_save != minute()) // only do stuff once per minute
-    {
-      min_save = minute();
-      checkSched(false);     // check every minute for next schedule
-      if (display.checkAlarms()) // returns true of an alarm == this time
-      {
-        nAlarming = 60;
-        jsonString js("alert");
-        js.Var("data", "Alarm");
-        ws.textAll(js.Close());
-      }
-
-      if ( min_save == 0)
-      {
-        ta.add();
-        if ( hour() == 2)     // update clock daily (at 2AM for DST)
-        {
-          udptime.start();
-          updateAll(false);    // update EEPROM daily
-        }
-        else if ( (hour() & 1) == 0) // even hour
-        {
-          updateAll(false);   // update EEPROM if changed
-        }
-        if ( mon_save != month() )
-        {
-          if (mon_save >= 0) // restart check
-            ee.tSecsMon[month() - 1] = 0;
-          mon_save = month();
-        }
-        CallHost(Reason_Setup);
-        getSeason();
-      }
-      if (min_save == 30)
-        ta.add(); // half hour log
-    }
-
-    if(nLightTimer) // in bed light timer
-    {
-      if(--nLightTimer == 0)
-      {
-        LightSwitch(0, 0);
-      }
-    }
-
-    if (nSnoozeTimer)
-    {
-      if (--nSnoozeTimer == 0)
-        nAlarming = 60;
-    }
-
-    if (nAlarming) // make noise
-    {
-      if (--nAlarming)
-      {
-        mus.add(3000, 500);
-      }
-    }
-
-    if (nWrongPass)
-      nWrongPass--;
-    if (digitalRead(HEAT))
-      onCounter++;
-    else if (onCounter)
-    {
-      ee.tSecsMon[month() - 1] += onCounter;
-      onCounter = 0;
-    }
-    if (display.m_bHeater == false && nOvershootCnt)
-      nOvershootCnt++;
-    static uint16_t s = 1;
-    if (ee.bEco && display.m_bHeater) // eco mode
-    {
-      bBoost = (display.m_currentTemp < display.m_loTemp - ee.pids[2]); // 0.5 deg diff
-      if (bBoost == false)
-      {
-        if (--s == 0)
-        {
-          bool bOn = digitalRead(HEAT);
-          s = (bOn) ? ee.pids[0] : ee.pids[1]; // off 60 secs /on 180 secs (75%)
-          digitalWrite(HEAT, !bOn);
-        }
-      }
-    }
-
-    if (display.m_bHeater != bLastOn || onCounter > (60 * 60 * 12)) // total up when it turns off or before 32 bit carry error
-    {
-      if (bLastOn)
-      {
-        updateAll( false );
-      }
-      bLastOn = display.m_bHeater;
-      ee.tSecsMon[month() - 1] += onCounter;
-      onCounter = 0;
-    }
-    if (display.m_bHeater)
-      nHeatCnt++;
-    else
-      nCoolCnt++;
-    if (nHeatETA)
-      nHeatETA--;
-    if (nCoolETA)
-      nCoolETA--;
-  }
-
-  delay(10);
+  applyCmds();
+  topics.service();
+  tasks.run();
+  publishState(); // for the web server's readers
+  tasks.idle(); // until a task is due or something is queued
 }
 
 void setHeat()
@@ -1235,65 +2009,39 @@ void checkTemp()
   static RunningMedian<uint16_t, 32> tempMedian;
   static RunningMedian<uint32_t, 8> heatTimeMedian;
   static RunningMedian<uint32_t, 8> coolTimeMedian;
-  static uint8_t state = 0;
+  dsSample smp;
 
-  switch (state)
-  {
-    case 0: // start a conversion
-      ds.reset();
-      ds.select(ds_addr);
-      ds.write(0x44, 0);   // start conversion, no parasite power on at the end
-      state++;
-      return;
-    case 1:
-      state++;
-      break;
-    case 2:
-      state = 0; // 1 second rest
-      return;
-  }
+  if (!sensors.m_dsq.pop(smp)) // read by the sensor task every 3 seconds
+    return;
 
-  uint8_t data[10];
-  uint8_t present = ds.reset();
-  ds.select(ds_addr);
-  ds.write(0xBE);         // Read Scratchpad
   IPAddress ip; // blank
 
-  if (!present)     // safety
+  if (smp.status == DS_MISSING)     // safety
   {
     display.m_bHeater = false;
     setHeat();
     static String s = "WARNING\r\nDS18 not detected";
     if(display.m_sNotifCurr != s)
     {
-      jsonString js("alert");
-      js.Var("data", "DS18 not present");
-      ws.textAll(js.Close());
+      sendAlert("DS18 not present");
       display.Notification(s, ip);
     }
     return;
   }
 
-  for ( int i = 0; i < 9; i++)          // we need 9 bytes
-    data[i] = ds.read();
-
-  if (OneWire::crc8( data, 8) != data[8]) // bad CRC
+  if (smp.status == DS_CRC) // bad CRC
   {
     display.m_bHeater = false;
     setHeat();
-    jsonString js("alert");
-    js.Var("data", "DS18 Invalid CRC");
-    ws.textAll(js.Close());
+    sendAlert("DS18 Invalid CRC");
     display.Notification("WARNING\r\nDS18 CRC error", ip);
     return;
   }
 
-  uint16_t raw = (data[1] << 8) | data[0];
+  uint16_t raw = smp.raw;
 
   if (raw > 630 || raw < 200) { // first reading is always 1360 (0x550)
-    jsonString js("alert");
-    js.Var("data", "DS18 Error");
-    ws.textAll(js.Close());
+    sendAlert("DS18 Error");
     display.Notification("WARNING\r\nDS18 error", ip);
     return;
   }
@@ -1308,11 +2056,11 @@ void checkTemp()
   uint16_t newTemp = t;
   static uint16_t oldHT;
 
-  if (display.m_currentTemp == 0 || oldHT == 0) // skip first read
+  if (oldHT == 0) // first read, the schedule was set at boot so control starts now
   {
     display.m_currentTemp = newTemp;
     oldHT = display.m_hiTemp;
-    return;
+    bootCtlMs = millis();
   }
 
   if (newTemp <= display.m_loTemp && display.m_bHeater == false)
@@ -1325,7 +2073,7 @@ void checkTemp()
   {
     display.m_bHeater = false;
     setHeat();
-    nHeatETA = 0;
+    heatETA.stop();
     nOvershootCnt = 1;
     nOvershootStartTemp = newTemp;
     ta.add();
@@ -1348,22 +2096,22 @@ void checkTemp()
       heatTimeMedian.getAverage(fCnt);
       uint32_t ct = fCnt;
       int16_t tDiff = display.m_hiTemp - newTemp;
-      nHeatETA = ct * tDiff;
+      uint32_t eta = ct * tDiff;
       /*      String s = "print;heatETA ";
-            s += nHeatETA;
+            s += eta;
             s += " ";
             s += ct;
             s += " ";
             s += tDiff;
             ws.textAll(s);
       */
-      int16_t ti = hour() * 60 + minute() + (nHeatETA / 60);
+      int16_t ti = hour() * 60 + minute() + (eta / 60);
 
       int16_t tt = tempAtTime( ti ); // get real target temp
       tDiff = tt - newTemp;
 
       if (tDiff < 0) tDiff = 0;
-      nHeatETA = ct * tDiff;
+      heatETA.start(ct * tDiff * 1000);
       nHeatCnt = 0;
     }
     else
@@ -1379,7 +2127,8 @@ void checkTemp()
       float fCnt;
       coolTimeMedian.getAverage(fCnt);
       uint32_t ct = fCnt;
-      nCoolETA = ct * tDiff;
+      if (tDiff < 0) tDiff = 0;
+      coolETA.start(ct * tDiff * 1000);
       nCoolCnt = 0;
       if (nOvershootPeak)
       {
@@ -1430,19 +2179,30 @@ String timeFmt(uint32_t v)
 
 void wsprint(String s)
 {
+  if (!topics.wanted(TP_DEBUG))
+    return;
   jsonString js("print");
   js.Var("text", s);
-  ws.textAll( js.Close());
+  topics.publish(TP_DEBUG, js.Close());
 }
 
 void sendState()
 {
-  ws.textAll( dataJson() );
-  delay(10); // maybe fix the Windows issue
-  ssCnt = ee.rate;
+  publishState();
+  bNotifAck = false; // reported once
+  topics.publish(TP_STATE, dataJson(), false, display.m_currentTemp,
+    digitalRead(HEAT) | (presence.present() << 1) | (display.m_hiTemp << 2));
+  tasks.start(tState, max(ee.rate, (uint16_t)1) * 1000UL);
 }
 
 // Check the buttons
+#ifdef ESP32
+void IRAM_ATTR btnISR()
+{
+  tasks.wakeISR();
+}
+#endif
+
 void checkButtons()
 {
   static bool bState;
@@ -1466,6 +2226,7 @@ void checkButtons()
       bState = bNewState;
       if (bState == LOW) // pressed
       {
+        presence.activity(PI_BUTTON, millis());
         if (display.isOff()) // skip first press with display off
           display.screen(true);
         else
@@ -1487,8 +2248,7 @@ void checkButtons()
 
   if (bInvoke)
   {
-    nAlarming = 0;
-    nSnoozeTimer = 60 * 5; // snooze for 5m
+    alarms.snooze(now());
   }
   lbState = bNewState;
 }
@@ -1498,17 +2258,17 @@ void changeTemp(int delta, bool bAll)
   if (ee.bVaca) return;
   if (bAll)
   {
-    for (int i = 0; i < ee.schedCnt[display.m_season]; i++)
-      ee.schedule[display.m_season][i].setTemp += delta;
+    for (int i = 0; i < sched.count(display.m_season); i++)
+      sched.item(display.m_season, i).setTemp += delta;
   }
   else if (ee.bAvg) // bump both used in avg mode
   {
-    ee.schedule[display.m_season][display.m_schInd].setTemp += delta;
-    ee.schedule[display.m_season][ (display.m_schInd + 1) % ee.schedCnt[display.m_season]].setTemp += delta;
+    sched.day(display.m_schInd).setTemp += delta;
+    sched.day( (display.m_schInd + 1) % sched.dayCnt()).setTemp += delta;
   }
   else
   {
-    ee.schedule[display.m_season][display.m_schInd].setTemp += delta;
+    sched.day(display.m_schInd).setTemp += delta;
   }
   checkLimits();
   checkSched(false);     // update temp
@@ -1516,59 +2276,69 @@ void changeTemp(int delta, bool bAll)
 
 void checkLimits()
 {
-  for (int i = 0; i < ee.schedCnt[display.m_season]; i++)
+  for (int i = 0; i < sched.used(); i++)
   {
     if (bCF)
-      ee.schedule[display.m_season][i].setTemp = constrain(ee.schedule[display.m_season][i].setTemp, 155, 322); // sanity check (15.5~32.2)
+      ee.schedule[i].setTemp = constrain(ee.schedule[i].setTemp, 155, 322); // sanity check (15.5~32.2)
     else
-      ee.schedule[display.m_season][i].setTemp = constrain(ee.schedule[display.m_season][i].setTemp, 600, 900); // sanity check (60~90)
-    ee.schedule[display.m_season][i].thresh = constrain(ee.schedule[display.m_season][i].thresh, 1, 100); // (50~80)
+      ee.schedule[i].setTemp = constrain(ee.schedule[i].setTemp, 600, 900); // sanity check (60~90)
+    ee.schedule[i].thresh = constrain(ee.schedule[i].thresh, 1, 100); // (50~80)
+    ee.schedule[i].timeSch %= (24 * 60);
+    ee.schedule[i].wday &= 0x7F;
   }
 }
 
 void checkSched(bool bUpdate)
 {
   long timeNow = (hour() * 60) + minute();
+  static uint8_t wday_save, season_save;
+
+  if (bUpdate || wday_save != weekday() || season_save != display.m_season) // new day or changed entries
+  {
+    wday_save = weekday();
+    season_save = display.m_season;
+    sched.compile(display.m_season, wday_save);
+    bUpdate = true;
+  }
+
+  uint8_t cnt = sched.dayCnt();
 
   if (bUpdate)
   {
-    display.m_schInd = ee.schedCnt[display.m_season] - 1;
-    for (int i = 0; i < ee.schedCnt[display.m_season]; i++) // any time check
-      if (timeNow >= ee.schedule[display.m_season][i].timeSch && timeNow < ee.schedule[display.m_season][i + 1].timeSch)
-      {
+    display.m_schInd = cnt - 1; // before the first is still the last of yesterday
+    for (int i = 0; i < cnt; i++) // any time check
+      if (timeNow >= sched.day(i).timeSch)
         display.m_schInd = i;
-        break;
-      }
   }
-  else for (int i = 0; i < ee.schedCnt[display.m_season]; i++) // on-time check
+  else for (int i = 0; i < cnt; i++) // on-time check
     {
-      if (timeNow == ee.schedule[display.m_season][i].timeSch)
+      if (timeNow == sched.day(i).timeSch)
       {
         display.m_schInd = i;
         break;
       }
     }
 
-  display.m_hiTemp = ee.bVaca ? ee.vacaTemp : ee.schedule[display.m_season][display.m_schInd].setTemp;
-  display.m_loTemp = ee.bVaca ? (display.m_hiTemp - 10) : (display.m_hiTemp - ee.schedule[display.m_season][display.m_schInd].thresh);
-  int thresh = ee.schedule[display.m_season][display.m_schInd].thresh;
+  display.m_hiTemp = ee.bVaca ? ee.vacaTemp : sched.day(display.m_schInd).setTemp;
+  display.m_loTemp = ee.bVaca ? (display.m_hiTemp - 10) : (display.m_hiTemp - sched.day(display.m_schInd).thresh);
+  int thresh = sched.day(display.m_schInd).thresh;
 
   if (!ee.bVaca && ee.bAvg) // averageing mode
   {
-    int start = ee.schedule[display.m_season][display.m_schInd].timeSch;
+    int start = sched.day(display.m_schInd).timeSch;
     int range;
     int s2;
 
     // Find minute range between schedules
-    if (display.m_schInd == ee.schedCnt[display.m_season] - 1) // rollover
+    if (display.m_schInd == cnt - 1) // rollover
     {
       s2 = 0;
-      range = ee.schedule[display.m_season][s2].timeSch + (24 * 60) - start;
+      range = sched.day(s2).timeSch + (24 * 60) - start;
     }
     else
     {
       s2 = display.m_schInd + 1;
-      range = ee.schedule[display.m_season][s2].timeSch - start;
+      range = sched.day(s2).timeSch - start;
     }
 
     int m = (hour() * 60) + minute(); // current TOD in minutes
@@ -1578,16 +2348,16 @@ void checkSched(bool bUpdate)
     else
       m -= start;
 
-    display.m_hiTemp = tween(ee.schedule[display.m_season][display.m_schInd].setTemp, ee.schedule[display.m_season][s2].setTemp, m, range);
-    thresh = tween(ee.schedule[display.m_season][display.m_schInd].thresh, ee.schedule[display.m_season][s2].thresh, m, range);
+    display.m_hiTemp = tween(sched.day(display.m_schInd).setTemp, sched.day(s2).setTemp, m, range);
+    thresh = tween(sched.day(display.m_schInd).thresh, sched.day(s2).thresh, m, range);
     display.m_loTemp = display.m_hiTemp - thresh;
   }
 }
 
 uint16_t tempAtTime(uint16_t timeTo) // in minutes
 {
-  uint8_t idx = ee.schedCnt[display.m_season] - 1;
-  uint16_t temp;
+  uint8_t cnt = sched.dayCnt();
+  uint8_t idx = cnt - 1;
 
   if (ee.bVaca)
   {
@@ -1596,39 +2366,36 @@ uint16_t tempAtTime(uint16_t timeTo) // in minutes
 
   timeTo %= (24 * 60);
 
-  for (int i = 0; i < ee.schedCnt[display.m_season]; i++) // any time check
-    if (timeTo >= ee.schedule[display.m_season][i].timeSch && timeTo < ee.schedule[display.m_season][i + 1].timeSch)
-    {
+  for (int i = 0; i < cnt; i++) // any time check
+    if (timeTo >= sched.day(i).timeSch)
       idx = i;
-      break;
-    }
 
   if (!ee.bAvg) // not averageing mode
   {
-    return ee.schedule[display.m_season][idx].setTemp;
+    return sched.day(idx).setTemp;
   }
 
-  int start = ee.schedule[display.m_season][idx].timeSch;
+  int start = sched.day(idx).timeSch;
   int range;
   int s2;
 
   // Find minute range between schedules
-  if (idx == ee.schedCnt[display.m_season] - 1) // rollover
+  if (idx == cnt - 1) // rollover
   {
     s2 = 0;
-    range = ee.schedule[display.m_season][s2].timeSch + (24 * 60) - start;
+    range = sched.day(s2).timeSch + (24 * 60) - start;
   }
   else
   {
     s2 = idx + 1;
-    range = ee.schedule[display.m_season][s2].timeSch - start;
+    range = sched.day(s2).timeSch - start;
   }
 
   if (timeTo < start) // offset by start of current schedule
     timeTo -= start - (24 * 60); // rollover
   else
     timeTo -= start;
-  return tween(ee.schedule[display.m_season][idx].setTemp, ee.schedule[display.m_season][s2].setTemp, timeTo, range);
+  return tween(sched.day(idx).setTemp, sched.day(s2).setTemp, timeTo, range);
 }
 
 // avarge value at current minute between times
@@ -1640,9 +2407,38 @@ int tween(int t1, int t2, int m, int range)
 }
 
 #ifdef ENABLE_HVAC_SENSOR
+WiFiUDP telemUdp;
+
+void sendTelemetry()
+{
+  static uint32_t seq;
+  telemPacket pkt;
+  IPAddress ip = peers.ip(PEER_HVAC);
+
+  if (ip[0] == 0) // not set
+    return;
+  if (year() < 2020) // no time yet, a low seq would be taken as a replay until the clock is set
+    return;
+  memset(&pkt, 0, sizeof(pkt));
+  seq = max(seq + 1, (uint32_t)now()); // keeps increasing across restarts
+  pkt.id = WBID;
+  pkt.seq = seq;
+  pkt.temp = display.m_roomTemp;
+  pkt.rh = display.m_rh;
+  pkt.flags = bCF ? TF_CELSIUS : 0;
+  pkt.ver = TELEM_VER;
+#ifdef TELEM_KEY
+  telemSign(pkt, (const uint8_t *)TELEM_KEY);
+#endif
+  telemUdp.beginPacket(ip, TELEM_PORT);
+  telemUdp.write((uint8_t *)&pkt, sizeof(pkt));
+  telemUdp.endPacket();
+}
+
 void updateHvac()
 {
-  if (ee.hvacIP[0] == 0) // not set
+  IPAddress ip = peers.ip(PEER_HVAC);
+  if (ip[0] == 0) // not set
     return;
 
   uriString uri("/s");
@@ -1654,9 +2450,6 @@ void updateHvac()
   uri.Param("rmtrh", display.m_rh);
   uri.Param("rmtname", WBID);
 
-  IPAddress ip(ee.hvacIP);
-  String url = ip.toString();
-  jsonPush.begin(url.c_str(), uri.string().c_str(), 80, false, false, NULL, NULL);
-  jsonPush.setList(jsonListPush);
+  callQueue.add(ip, uri.string(), ee.hvacPort, CQ_HVAC);
 }
 #endif
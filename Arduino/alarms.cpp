@@ -0,0 +1,153 @@
+#include "alarms.h"
+#include "music.h"
+
+extern Music mus;
+
+struct AlarmStage
+{
+  uint8_t start; // seconds into the alarm
+  uint8_t every; // seconds between repeats
+  uint8_t beeps; // beeps per repeat, 0 = the alarm's song
+};
+
+static const AlarmStage stages[] =
+{
+  {  0,  2, 1},
+  { 30,  1, 1},
+  { 60,  1, 2},
+  { 90, 15, 0},
+  {150,  0, 0}, // done
+};
+
+// Earliest time after 'from' that any alarm rings, 0 if none have days set
+// Weekday bits: bit 0 = Sunday. 1/1/1970 was a Thursday.
+time_t Alarms::nextFire(const Alarm *pAlarm, uint8_t cnt, time_t from, int8_t *pIdx)
+{
+  uint32_t day = from / (24*60*60);
+  uint16_t tm = (from % (24*60*60)) / 60;
+  time_t best = 0;
+
+  *pIdx = -1;
+  for(uint8_t d = 0; d <= 7 && best == 0; d++) // today through the same day next week
+  {
+    uint8_t bit = 1 << ((day + d + 4) % 7);
+    for(uint8_t i = 0; i < cnt; i++)
+    {
+      if((pAlarm[i].wday & bit) == 0 || pAlarm[i].timeSch >= 24*60)
+        continue;
+      if(d == 0 && pAlarm[i].timeSch <= tm) // already passed today
+        continue;
+      time_t t = (time_t)(day + d) * (24*60*60) + pAlarm[i].timeSch * 60;
+      if(best == 0 || t < best)
+      {
+        best = t;
+        *pIdx = i;
+      }
+    }
+  }
+  return best;
+}
+
+// call when the alarms or the clock are changed
+void Alarms::update(time_t now)
+{
+  m_sched = nextFire(ee.alarm, MAX_ALARM, (now > m_last) ? now : m_last, &m_nextIdx);
+  m_next = m_sched;
+  if(m_snooze && (m_next == 0 || m_snooze < m_next))
+    m_next = m_snooze;
+}
+
+// returns true when an alarm starts ringing. Disabled alarms still move on to the next one
+bool Alarms::check(time_t now, bool bEnabled)
+{
+  if(m_next == 0 || now < m_next)
+    return false;
+
+  bool bRing = (now - m_next < ALARM_LATE);
+  int8_t idx = m_idx;
+
+  if(m_snooze && m_snooze <= now)
+    m_snooze = 0;
+  else
+  {
+    m_last = m_sched;
+    idx = m_nextIdx;
+  }
+  update(now);
+  if(!bEnabled || !bRing || idx < 0)
+    return false;
+  m_idx = idx;
+  m_secs = 0;
+  m_bRinging = true;
+  return true;
+}
+
+// once per second while ringing
+void Alarms::service()
+{
+  if(!m_bRinging)
+    return;
+
+  uint8_t s = 0;
+  while(s < sizeof(stages) / sizeof(stages[0]) - 1 && m_secs >= stages[s + 1].start)
+    s++;
+
+  const AlarmStage &st = stages[s];
+  if(st.every == 0)
+  {
+    stop();
+    return;
+  }
+  if((m_secs - st.start) % st.every == 0)
+  {
+    const Alarm &a = ee.alarm[m_idx];
+    uint16_t freq = a.freq ? a.freq : 3000;
+    uint16_t ms = a.ms ? a.ms : 500;
+
+    if(st.beeps == 0 && a.song)
+      mus.play(a.song - 1);
+    else
+    {
+      uint8_t n = st.beeps ? st.beeps : 3;
+      for(uint8_t i = 0; i < n; i++)
+      {
+        mus.add(freq, (n > 1) ? ms / 2 : ms);
+        if(n > 1)
+          mus.add(0, ms / 4); // gap
+      }
+    }
+  }
+  m_secs++;
+}
+
+void Alarms::snooze(time_t now)
+{
+  if(!m_bRinging)
+    return;
+  stop();
+  m_snooze = now + SNOOZE_TIME;
+  if(m_next == 0 || m_snooze < m_next)
+    m_next = m_snooze;
+}
+
+void Alarms::stop()
+{
+  m_bRinging = false;
+  m_snooze = 0;
+  m_next = m_sched;
+}
+
+bool Alarms::active()
+{
+  return m_bRinging;
+}
+
+time_t Alarms::next()
+{
+  return m_next;
+}
+
+int8_t Alarms::nextIdx()
+{
+  return m_nextIdx;
+}
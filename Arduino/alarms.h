@@ -0,0 +1,38 @@
+#ifndef ALARMS_H
+#define ALARMS_H
+
+#include <Arduino.h>
+#include "eeMem.h"
+
+#define SNOOZE_TIME  (5*60) // seconds
+#define ALARM_LATE   (60*60) // still ring when the clock jumps past an alarm by less than this (DST)
+
+// The next fire time is worked out once from all entries whenever the alarms or the
+// clock change, so the regular check is a single compare.  Times are local seconds.
+class Alarms
+{
+public:
+  Alarms(){}
+  void update(time_t now);
+  bool check(time_t now, bool bEnabled);
+  void service(void);
+  void snooze(time_t now);
+  void stop(void);
+  bool active(void);
+  time_t next(void);
+  int8_t nextIdx(void);
+  static time_t nextFire(const Alarm *pAlarm, uint8_t cnt, time_t from, int8_t *pIdx);
+private:
+  time_t  m_next;   // min of m_sched and m_snooze
+  time_t  m_sched;  // next scheduled alarm, 0 = none
+  time_t  m_snooze; // snooze end, 0 = none
+  time_t  m_last;   // last alarm fired, keeps a repeated hour (DST) from ringing twice
+  int8_t  m_nextIdx = -1;
+  int8_t  m_idx = -1;  // alarm ringing
+  uint16_t m_secs;     // seconds since it started ringing
+  bool    m_bRinging;
+};
+
+extern Alarms alarms;
+
+#endif // ALARMS_H
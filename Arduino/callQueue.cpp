@@ -0,0 +1,252 @@
+#include "callQueue.h"
+#include "tasks.h"
+#include "eeMem.h"
+#include "jsonstring.h"
+
+static_assert(CQ_CONN == 2, "add jcCallback<n> entries to the constructor");
+
+CallQueue *CallQueue::m_pThis;
+
+CallQueue::CallQueue(void (*callback)(int16_t iName, int iValue, char *psValue), const char **pList)
+  : m_jc{jcCallback<0>, jcCallback<1>}
+{
+  m_pThis = this;
+  m_callback = callback;
+  m_pList = pList;
+  for(uint8_t i = 0; i < CQ_CONN; i++)
+  {
+    m_conn[i].req = -1;
+    m_gen[i] = 0;
+  }
+}
+
+// each connection gets its own callback so completions can be matched to it
+template<int n> void CallQueue::jcCallback(int16_t iName, int iValue, char *psValue)
+{
+  if(iName >= 0)
+  {
+    m_pThis->m_callback(iName, iValue, psValue);
+    return;
+  }
+  if(iValue == JC_CONNECTED)
+    return;
+
+  cqStatus st;
+
+  st.conn = n;
+  st.gen = m_pThis->m_gen[n];
+  st.bOk = (iValue == JC_DONE); // else timeout, no connect, etc.
+  m_pThis->m_status.push(&st);  // done() runs in loop(), a full queue is caught by the timeout
+  tasks.wake();
+}
+
+// Queue a call.  A waiting request with the same key is replaced so only the latest state is sent
+bool CallQueue::add(IPAddress ip, String sUri, uint16_t port, uint8_t key)
+{
+  int8_t idx = -1;
+
+  if(sUri.length() >= CQ_URI)
+  {
+    m_stats.dropped++;
+    return false;
+  }
+
+  for(uint8_t i = 0; i < CQ_CNT; i++)
+  {
+    if(m_req[i].port == 0)
+    {
+      if(idx < 0) idx = i;
+      continue;
+    }
+    if(key == CQ_NONE || m_req[i].key != key)
+      continue;
+    bool bSending = false;
+    for(uint8_t c = 0; c < CQ_CONN; c++)
+      if(m_conn[c].req == i)
+        bSending = true;
+    if(!bSending)
+    {
+      idx = i;
+      m_stats.merged++;
+      break;
+    }
+  }
+
+  if(idx < 0)
+  {
+    m_stats.dropped++;
+    return false;
+  }
+  if(m_req[idx].port == 0) // new entry goes to the back
+    m_req[idx].seq = m_seq++;
+  m_req[idx].ip = ip;
+  m_req[idx].port = port;
+  m_req[idx].key = key;
+  m_req[idx].tries = 0;
+  strcpy(m_req[idx].szUri, sUri.c_str());
+  addDest(ip, port); // if none is free it's tried again when sent
+  return true;
+}
+
+// lookup only, -1 if it isn't tracked
+int8_t CallQueue::findDest(IPAddress ip, uint16_t port)
+{
+  for(uint8_t i = 0; i < CQ_DEST; i++)
+    if(m_dest[i].port == port && m_dest[i].ip == ip)
+      return i;
+  return -1;
+}
+
+// tracked one, or a new record.  Only a free one or one with nothing to lose is taken
+int8_t CallQueue::addDest(IPAddress ip, uint16_t port)
+{
+  int8_t idx = findDest(ip, port);
+
+  if(idx >= 0)
+    return idx;
+  for(uint8_t i = 0; i < CQ_DEST; i++)
+    if(m_dest[i].port == 0)
+    {
+      idx = i;
+      break;
+    }
+
+  if(idx < 0) // reuse one that isn't busy and has no pending backoff
+  {
+    for(uint8_t i = 0; i < CQ_DEST; i++)
+      if(!m_dest[i].bBusy && m_dest[i].fails == 0)
+      {
+        idx = i;
+        break;
+      }
+    if(idx < 0)
+      return -1;
+  }
+  m_dest[idx].ip = ip;
+  m_dest[idx].port = port;
+  m_dest[idx].fails = 0;
+  m_dest[idx].bBusy = false;
+  return idx;
+}
+
+// call from loop()
+void CallQueue::service()
+{
+  cqStatus st;
+
+  while(m_status.pop(st))
+  {
+    if(st.gen != m_gen[st.conn] || m_conn[st.conn].req < 0)
+      m_stats.stale++;
+    else
+      done(st.conn, st.bOk);
+  }
+
+  for(uint8_t c = 0; c < CQ_CONN; c++)
+  {
+    if(m_conn[c].req >= 0)
+    {
+      if(millis() - m_conn[c].startMs > CQ_TIMEOUT) // never completed
+      {
+        m_jc[c].end();
+        done(c, false);
+        m_conn[c].endMs = millis();
+        m_conn[c].bEnded = true;
+      }
+      continue;
+    }
+    if(m_conn[c].bEnded)
+    {
+      if(millis() - m_conn[c].endMs < CQ_LINGER)
+        continue;
+      m_conn[c].bEnded = false;
+    }
+
+    // oldest request whose destination is ready
+    int8_t r = -1, d = -1;
+    for(uint8_t i = 0; i < CQ_CNT; i++)
+    {
+      if(m_req[i].port == 0 || (r >= 0 && (int32_t)(m_req[i].seq - m_req[r].seq) > 0))
+        continue;
+      bool bSending = false;
+      for(uint8_t n = 0; n < CQ_CONN; n++)
+        if(m_conn[n].req == i)
+          bSending = true;
+      if(bSending)
+        continue;
+      int8_t di = findDest(m_req[i].ip, m_req[i].port); // untracked is ready, it gets a record once picked
+      if(di >= 0 && (m_dest[di].bBusy || (m_dest[di].fails && (int32_t)(millis() - m_dest[di].retryMs) < 0)))
+        continue;
+      r = i;
+      d = di;
+    }
+    if(r < 0)
+      continue;
+    if(d < 0 && (d = addDest(m_req[r].ip, m_req[r].port)) < 0)
+      continue; // every record is busy or backing off
+
+    m_gen[c]++;
+    m_conn[c].req = r;
+    m_conn[c].dest = d;
+    m_conn[c].startMs = millis();
+    m_dest[d].bBusy = true;
+    m_stats.sent++;
+    if(m_req[r].tries)
+      m_stats.retry++;
+    if(m_jc[c].begin(m_req[r].ip, m_req[r].szUri, m_req[r].port, false, false, NULL, NULL, 1))
+      m_jc[c].setList(m_pList);
+    else
+      done(c, false);
+  }
+}
+
+void CallQueue::done(uint8_t c, bool bOk) // loop() only
+{
+  int8_t r = m_conn[c].req;
+  if(r < 0)
+    return;
+
+  m_gen[c]++;
+  cqDest &d = m_dest[m_conn[c].dest];
+  d.bBusy = false;
+  m_conn[c].req = -1;
+
+  if(bOk)
+  {
+    uint16_t lat = min(millis() - m_conn[c].startMs, 65535UL);
+    m_stats.ok++;
+    m_stats.latTotal += lat;
+    if(lat > m_stats.latMax)
+      m_stats.latMax = lat;
+    d.fails = 0;
+    m_req[r].port = 0;
+    return;
+  }
+
+  m_stats.fail++;
+  if(d.fails < 16)
+    d.fails++;
+  d.retryMs = millis() + min((uint32_t)500 << d.fails, (uint32_t)CQ_BACKOFF);
+
+  if(++m_req[r].tries >= CQ_TRIES)
+  {
+    m_req[r].port = 0;
+    m_stats.dropped++;
+  }
+}
+
+String CallQueue::statsJson()
+{
+  jsonString js;
+
+  js.Var("sent", m_stats.sent);
+  js.Var("ok", m_stats.ok);
+  js.Var("fail", m_stats.fail);
+  js.Var("retry", m_stats.retry);
+  js.Var("drop", m_stats.dropped);
+  js.Var("merged", m_stats.merged);
+  js.Var("stale", m_stats.stale);
+  js.Var("latAvg", m_stats.ok ? m_stats.latTotal / m_stats.ok : 0);
+  js.Var("latMax", m_stats.latMax);
+  return js.Close();
+}
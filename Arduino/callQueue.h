@@ -0,0 +1,108 @@
+#ifndef CALLQUEUE_H
+#define CALLQUEUE_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <JsonClient.h>
+#include <atomic>
+#include "mpscQueue.h"
+
+#define CQ_CNT      16   // queued requests
+#define CQ_URI      100  // max path+query length
+#define CQ_CONN     2    // concurrent connections
+#define CQ_DEST     6    // destinations tracked for backoff
+#define CQ_TRIES    4    // attempts before a request is dropped
+#define CQ_TIMEOUT  10000 // ms before an unanswered connection is dropped
+#define CQ_BACKOFF  60000 // max ms between retries
+#define CQ_LINGER   2000  // ms a timed out connection rests, for its late callbacks
+
+// coalesce keys. A new request replaces a waiting one with the same key
+enum cqKey
+{
+  CQ_NONE,
+  CQ_HOST,
+  CQ_LIGHT_PWR,
+  CQ_LIGHT_LVL,
+  CQ_FAN,
+  CQ_HVAC,
+};
+
+struct cqReq
+{
+  IPAddress ip;
+  uint16_t port;      // 0 = free
+  uint8_t  key;
+  uint8_t  tries;
+  uint32_t seq;       // FIFO order
+  char     szUri[CQ_URI];
+};
+
+struct cqDest
+{
+  IPAddress ip;
+  uint16_t port;      // 0 = free
+  uint8_t  fails;     // consecutive failures
+  bool     bBusy;     // one connection per destination keeps requests in order
+  uint32_t retryMs;   // millis() when the next attempt is allowed
+};
+
+struct cqConn
+{
+  int8_t   req;       // -1 = idle
+  int8_t   dest;
+  uint32_t startMs;
+  uint32_t endMs;     // when a timed out connection was ended
+  bool     bEnded;    // rests for CQ_LINGER after that
+};
+
+struct cqStatus       // from a JsonClient callback to loop()
+{
+  uint8_t  conn;
+  uint8_t  gen;       // the connection's generation when it was called
+  bool     bOk;
+};
+
+struct cqStats
+{
+  uint32_t sent;
+  uint32_t ok;
+  uint32_t fail;      // failed attempts
+  uint32_t retry;
+  uint32_t dropped;   // queue full or out of tries
+  uint32_t merged;    // coalesced into a waiting request
+  uint32_t stale;     // callbacks from an earlier request, ignored
+  uint32_t latTotal;  // ms, successful calls
+  uint16_t latMax;
+};
+
+class CallQueue
+{
+public:
+  CallQueue(void (*callback)(int16_t iName, int iValue, char *psValue), const char **pList);
+  bool add(IPAddress ip, String sUri, uint16_t port, uint8_t key = CQ_NONE);
+  void service(void);
+  String statsJson(void);
+
+  cqStats m_stats;
+
+private:
+  template<int n> static void jcCallback(int16_t iName, int iValue, char *psValue);
+  void done(uint8_t c, bool bOk);
+  int8_t findDest(IPAddress ip, uint16_t port);
+  int8_t addDest(IPAddress ip, uint16_t port);
+
+  static CallQueue *m_pThis;
+  void (*m_callback)(int16_t iName, int iValue, char *psValue);
+  const char **m_pList;
+  JsonClient m_jc[CQ_CONN];
+  cqConn  m_conn[CQ_CONN];
+  std::atomic<uint8_t> m_gen[CQ_CONN]; // bumped on each start and finish, so late callbacks don't match
+  MpscQueue<cqStatus, 8> m_status;     // the callbacks run on the TCP task
+  cqReq   m_req[CQ_CNT];
+  cqDest  m_dest[CQ_DEST];
+  uint32_t m_seq;
+};
+
+extern CallQueue callQueue;
+
+#endif // CALLQUEUE_H
@@ -0,0 +1,112 @@
+#include "clientLimit.h"
+#include "eeMem.h" // for jsonString
+#include "jsonstring.h"
+
+clClient *ClientLimit::find(uint32_t ip, uint32_t ms)
+{
+  for (uint8_t i = 0; i < CL_SLOTS; i++)
+    if (m_cl[i].ip == ip)
+      return &m_cl[i];
+
+  clClient *pOld = NULL; // a free slot, else the longest idle client that isn't locked out
+
+  for (uint8_t i = 0; i < CL_SLOTS; i++)
+  {
+    clClient &c = m_cl[i];
+
+    if (c.ip == 0)
+    {
+      pOld = &c;
+      break;
+    }
+    if ((int32_t)(c.lockMs - ms) > 0)
+      continue;
+    if (pOld == NULL || ms - c.seenMs > ms - pOld->seenMs)
+      pOld = &c;
+  }
+  if (pOld == NULL) // all locked out
+    for (uint8_t i = 0; i < CL_SLOTS; i++)
+      if (pOld == NULL || ms - m_cl[i].seenMs > ms - pOld->seenMs)
+        pOld = &m_cl[i];
+
+  if (pOld->ip)
+    m_stats.evicted++;
+  memset(pOld, 0, sizeof(clClient));
+  pOld->ip = ip;
+  pOld->seenMs = ms;
+  pOld->creditMs = CL_COST * CL_BURST;
+  pOld->lockMs = ms;
+  pOld->failMs = ms - CL_FORGET;
+  return pOld;
+}
+
+bool ClientLimit::allow(uint32_t ip, uint32_t ms)
+{
+  clClient *c = find(ip, ms);
+
+  if ((int32_t)(c->lockMs - ms) > 0)
+  {
+    m_stats.locked++;
+    return false;
+  }
+
+  uint32_t elapsed = ms - c->seenMs;
+  if (elapsed > CL_COST * CL_BURST)
+    elapsed = CL_COST * CL_BURST;
+  c->creditMs += elapsed;
+  if (c->creditMs > CL_COST * CL_BURST)
+    c->creditMs = CL_COST * CL_BURST;
+  c->seenMs = ms;
+
+  if (c->creditMs < CL_COST)
+  {
+    m_stats.limited++;
+    return false;
+  }
+  c->creditMs -= CL_COST;
+  m_stats.allowed++;
+  return true;
+}
+
+void ClientLimit::authFail(uint32_t ip, uint32_t ms)
+{
+  clClient *c = find(ip, ms);
+
+  m_stats.fails++;
+  if (ms - c->failMs >= CL_FORGET)
+    c->fails = 0;
+  c->failMs = ms;
+
+  uint32_t lock = CL_LOCK << (c->fails < 9 ? c->fails : 9);
+  if (lock > CL_LOCK_MAX)
+    lock = CL_LOCK_MAX;
+  if (c->fails < 255)
+    c->fails++;
+  c->lockMs = ms + lock;
+}
+
+void ClientLimit::authOk(uint32_t ip)
+{
+  for (uint8_t i = 0; i < CL_SLOTS; i++)
+    if (m_cl[i].ip == ip)
+      m_cl[i].fails = 0;
+}
+
+String ClientLimit::statsJson()
+{
+  jsonString js;
+  uint32_t ms = millis();
+  uint8_t lockouts = 0;
+
+  for (uint8_t i = 0; i < CL_SLOTS; i++)
+    if (m_cl[i].ip && (int32_t)(m_cl[i].lockMs - ms) > 0)
+      lockouts++;
+
+  js.Var("allowed", m_stats.allowed);
+  js.Var("limited", m_stats.limited);
+  js.Var("locked", m_stats.locked);
+  js.Var("fails", m_stats.fails);
+  js.Var("evicted", m_stats.evicted);
+  js.Var("lockouts", lockouts); // clients locked out now
+  return js.Close();
+}
@@ -0,0 +1,51 @@
+#ifndef CLIENTLIMIT_H
+#define CLIENTLIMIT_H
+
+#include <Arduino.h>
+
+#define CL_SLOTS    8        // clients tracked
+#define CL_COST     500      // ms of credit a request uses, so 2 a second
+#define CL_BURST    10       // requests allowed back to back
+#define CL_LOCK     10000    // ms locked out after the first wrong key, doubles with each one after
+#define CL_LOCK_MAX 3600000  // 1 hour
+#define CL_FORGET   3600000  // ms since the last wrong key before the count starts over
+
+struct clClient
+{
+  uint32_t ip;       // 0 = free
+  uint32_t seenMs;   // last request, for reuse of the oldest slot
+  uint32_t creditMs; // token bucket, CL_COST per request up to CL_BURST of them
+  uint32_t lockMs;   // locked out until
+  uint32_t failMs;   // last wrong key
+  uint8_t  fails;    // wrong keys in a row
+};
+
+struct clStats
+{
+  uint32_t allowed;
+  uint32_t limited;  // over the rate
+  uint32_t locked;   // refused during a lockout
+  uint32_t fails;    // wrong or missing keys
+  uint32_t evicted;  // slots taken over by a new client
+};
+
+// Per client request rate and wrong key lockout, checked before any parameters are decoded.
+// Only used from the web server's task, so it has no lock
+class ClientLimit
+{
+public:
+  ClientLimit(){}
+  bool allow(uint32_t ip, uint32_t ms); // false to refuse the request
+  void authFail(uint32_t ip, uint32_t ms);
+  void authOk(uint32_t ip);
+  String statsJson(void);
+private:
+  clClient *find(uint32_t ip, uint32_t ms);
+
+  clClient m_cl[CL_SLOTS];
+  clStats  m_stats;
+};
+
+extern ClientLimit clientLimit;
+
+#endif // CLIENTLIMIT_H
@@ -0,0 +1,101 @@
+#include "devCache.h"
+#include "eeMem.h" // for jsonString
+#include "jsonstring.h"
+
+DevCache::DevCache()
+{
+  for(uint8_t ch = 0; ch < DC_CNT; ch++)
+    m_ch[ch].want = m_ch[ch].have = -1;
+}
+
+void DevCache::forget(uint8_t ch)
+{
+  dcState &d = m_ch[ch];
+
+  d.have = -1;
+  d.tries = 0;
+}
+
+bool DevCache::want(uint8_t ch, int16_t v, uint32_t ms)
+{
+  dcState &d = m_ch[ch];
+
+  d.want = v;
+  if(d.tries == 0 && d.have == v && ms - d.haveMs < DC_STALE)
+  {
+    d.suppressed++;
+    return false;
+  }
+  if(d.tries && d.sentVal == v) // already on its way
+  {
+    d.suppressed++;
+    return false;
+  }
+
+  d.sentVal = v;
+  d.sentMs = ms;
+  d.sent++;
+  if(d.bReports)
+    d.tries = 1;
+  else // no reports to wait for
+  {
+    d.tries = 0;
+    d.have = v;
+    d.haveMs = ms;
+  }
+  return true;
+}
+
+void DevCache::report(uint8_t ch, int16_t v, uint32_t ms)
+{
+  dcState &d = m_ch[ch];
+
+  d.reports++;
+  d.bReports = true;
+  d.have = v;
+  d.haveMs = ms;
+
+  if(d.tries)
+  {
+    if(d.sentVal == v) // it got there
+      d.tries = 0;
+  }
+  else
+    d.want = v; // changed at the device, go with it
+}
+
+int8_t DevCache::reconcile(uint32_t ms)
+{
+  for(uint8_t ch = 0; ch < DC_CNT; ch++)
+  {
+    dcState &d = m_ch[ch];
+
+    if(d.tries == 0 || ms - d.sentMs < DC_CONFIRM)
+      continue;
+    if(d.tries >= DC_TRIES) // never reported back, take it as done
+    {
+      d.tries = 0;
+      d.have = d.sentVal;
+      d.haveMs = ms;
+      continue;
+    }
+    d.tries++;
+    d.sentMs = ms;
+    d.resent++;
+    return ch;
+  }
+  return -1;
+}
+
+String DevCache::statsJson()
+{
+  jsonString js;
+
+  for(uint8_t ch = 0; ch < DC_CNT; ch++)
+  {
+    static const char *pName[] = {"lightPwr", "lightLvl", "fanPwr"};
+    uint32_t a[4] = {m_ch[ch].sent, m_ch[ch].suppressed, m_ch[ch].resent, m_ch[ch].reports};
+    js.Array(pName[ch], a, 4); // sent, suppressed, resent, reports
+  }
+  return js.Close();
+}
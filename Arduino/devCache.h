@@ -0,0 +1,53 @@
+#ifndef DEVCACHE_H
+#define DEVCACHE_H
+
+#include <Arduino.h>
+
+#define DC_CONFIRM   10000   // ms to wait for a device to report a sent state
+#define DC_TRIES     3       // sends before an unconfirmed state is taken as done
+#define DC_STALE     600000  // ms a known state is trusted, then the next request goes out anyway
+
+enum dcChan
+{
+  DC_LIGHT_PWR,
+  DC_LIGHT_LVL,
+  DC_FAN_PWR,
+  DC_CNT
+};
+
+struct dcState
+{
+  int16_t  want;      // -1 = nothing asked yet
+  int16_t  have;      // last reported or taken as done, -1 = unknown
+  int16_t  sentVal;
+  uint8_t  tries;     // sends of sentVal waiting for a report, 0 = none
+  bool     bReports;  // the device has reported its state, so sends wait for that
+  uint32_t sentMs;
+  uint32_t haveMs;
+  uint32_t sent;
+  uint32_t suppressed;
+  uint32_t resent;
+  uint32_t reports;
+};
+
+// Desired and confirmed state of the dimmer and fan.  want() says if a request has to go out,
+// so repeats of the state a device is already in are dropped.  Reports pushed by the devices
+// confirm a send, or become the wanted state when changed at the device.  reconcile() resends
+// what wasn't confirmed.  loop() only
+class DevCache
+{
+public:
+  DevCache();
+  bool want(uint8_t ch, int16_t v, uint32_t ms);   // true if it has to be sent
+  void report(uint8_t ch, int16_t v, uint32_t ms); // state from the device
+  int8_t reconcile(uint32_t ms); // a channel to resend, -1 for none
+  int16_t wanted(uint8_t ch){ return m_ch[ch].want; }
+  void forget(uint8_t ch);       // new connection or address, state unknown
+  String statsJson(void);
+private:
+  dcState m_ch[DC_CNT];
+};
+
+extern DevCache devCache;
+
+#endif // DEVCACHE_H
@@ -0,0 +1,157 @@
+#include "discovery.h"
+
+Discovery *Discovery::m_pThis;
+
+#ifdef ESP32
+#define DISC_LOCK()    portENTER_CRITICAL(&m_mux)
+#define DISC_UNLOCK()  portEXIT_CRITICAL(&m_mux)
+#else
+#define DISC_LOCK()
+#define DISC_UNLOCK()
+#endif
+
+void Discovery::add(uint8_t peer, const char *pName, uint8_t *pIP, uint16_t *pPort)
+{
+  m_peer[peer].pName = pName;
+  m_peer[peer].pIP = pIP;
+  m_peer[peer].pPort = pPort;
+  m_peer[peer].seenMs = 0;
+}
+
+void Discovery::onChange(void (*callback)(uint8_t peer))
+{
+  m_callback = callback;
+}
+
+// call once WiFi is connected and MDNS is running
+void Discovery::start()
+{
+  if(m_bStarted)
+    return;
+  m_bStarted = true;
+  m_pThis = this;
+#ifdef ESP32
+  xTaskCreate(task, "mdns", 4096, this, 1, NULL);
+#else
+  query();
+#endif
+}
+
+// address to use, the last one found or saved
+IPAddress Discovery::ip(uint8_t peer)
+{
+  return IPAddress(m_peer[peer].pIP);
+}
+
+bool Discovery::fresh(uint8_t peer)
+{
+  return m_peer[peer].seenMs && (millis() - m_peer[peer].seenMs < DISC_TTL);
+}
+
+// may be called from the query task
+void Discovery::found(const char *pHost, IPAddress ip, uint16_t port)
+{
+  char szName[38];
+
+  strncpy(szName, pHost, sizeof(szName) - 1);
+  szName[sizeof(szName) - 1] = 0;
+  strtok(szName, "."); // remove .local
+
+  for(uint8_t i = 0; i < PEER_CNT; i++)
+  {
+    if(m_peer[i].pName == NULL || strcmp(szName, m_peer[i].pName))
+      continue;
+    DISC_LOCK();
+    m_newIP[i] = ip;
+    m_newPort[i] = port;
+    m_pending |= 1 << i;
+    DISC_UNLOCK();
+  }
+}
+
+// call from loop()
+void Discovery::service()
+{
+  if(!m_bStarted)
+    return;
+#ifdef ESP8266
+  bool bStale = false;
+  for(uint8_t i = 0; i < PEER_CNT; i++)
+    if(m_peer[i].pName && !fresh(i))
+      bStale = true;
+  if(millis() - m_queryMs > (bStale ? DISC_RETRY : DISC_REFRESH))
+    query();
+#endif
+
+  if(m_pending == 0)
+    return;
+
+  for(uint8_t i = 0; i < PEER_CNT; i++)
+  {
+    DISC_LOCK();
+    bool bNew = m_pending & (1 << i);
+    IPAddress ip = m_newIP[i];
+    uint16_t port = m_newPort[i];
+    m_pending &= ~(1 << i);
+    DISC_UNLOCK();
+
+    if(!bNew)
+      continue;
+    m_peer[i].seenMs = millis() | 1;
+    bool bChanged = false;
+    for(uint8_t b = 0; b < 4; b++)
+    {
+      if(m_peer[i].pIP[b] != ip[b])
+        bChanged = true;
+      m_peer[i].pIP[b] = ip[b];
+    }
+    if(m_peer[i].pPort && port && *m_peer[i].pPort != port)
+    {
+      *m_peer[i].pPort = port;
+      bChanged = true;
+    }
+    if(bChanged && m_callback)
+      m_callback(i);
+  }
+}
+
+#ifdef ESP32
+void Discovery::task(void *param)
+{
+  Discovery *pThis = (Discovery *)param;
+
+  for(;;)
+  {
+    int cnt = MDNS.queryService("iot", "tcp");
+    for(int i = 0; i < cnt; i++)
+      pThis->found(MDNS.hostname(i).c_str(), MDNS.address(i), MDNS.port(i));
+
+    bool bStale = false;
+    for(uint8_t i = 0; i < PEER_CNT; i++)
+      if(pThis->m_peer[i].pName && !pThis->fresh(i))
+        bStale = true;
+    vTaskDelay(pdMS_TO_TICKS(bStale ? DISC_RETRY : DISC_REFRESH));
+  }
+}
+#else
+// LEAmDNS answers arrive through MDNS.update() without blocking
+void Discovery::query()
+{
+  m_queryMs = millis();
+  if(m_hQuery)
+    MDNS.removeServiceQuery(m_hQuery);
+  m_hQuery = MDNS.installServiceQuery("iot", "tcp",
+    [](MDNSResponder::MDNSServiceInfo info, MDNSResponder::AnswerType answerType, bool bSetContent)
+    {
+      if(!bSetContent || answerType != MDNSResponder::AnswerType::IP4Address)
+        return;
+      if(!info.hostDomainAvailable() || !info.IP4AddressAvailable())
+        return;
+      for(IPAddress ip : info.IP4Adresses())
+      {
+        m_pThis->found(info.hostDomain(), ip, info.hostPortAvailable() ? info.hostPort() : 0);
+        break;
+      }
+    });
+}
+#endif
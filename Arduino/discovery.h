@@ -0,0 +1,66 @@
+#ifndef DISCOVERY_H
+#define DISCOVERY_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#ifdef ESP32
+#include <ESPmDNS.h>
+#else
+#include <ESP8266mDNS.h>
+#endif
+
+#define DISC_TTL      (30*60*1000) // ms a found address is trusted
+#define DISC_REFRESH  (10*60*1000) // ms between queries when all are fresh
+#define DISC_RETRY    (20*1000)    // ms between queries while one is missing
+
+enum peerId
+{
+  PEER_HVAC,
+  PEER_DIMMER,
+  PEER_FAN,
+  PEER_HOST,
+  PEER_CNT
+};
+
+struct Peer
+{
+  const char *pName;  // mDNS host name without .local
+  uint8_t  *pIP;      // saved address in ee, updated when it changes
+  uint16_t *pPort;    // saved port or NULL
+  uint32_t seenMs;    // millis() when last found, 0 = not yet
+};
+
+// Finds the other "iot" devices by name in the background and keeps their addresses in ee,
+// so a device that changes IP keeps working without a restart
+class Discovery
+{
+public:
+  Discovery(){}
+  void add(uint8_t peer, const char *pName, uint8_t *pIP, uint16_t *pPort);
+  void start(void);
+  void service(void);
+  IPAddress ip(uint8_t peer);
+  bool fresh(uint8_t peer);
+  void onChange(void (*callback)(uint8_t peer));
+private:
+  void found(const char *pHost, IPAddress ip, uint16_t port);
+#ifdef ESP32
+  static void task(void *param);
+  portMUX_TYPE m_mux = portMUX_INITIALIZER_UNLOCKED;
+#else
+  void query(void);
+  MDNSResponder::hMDNSServiceQuery m_hQuery;
+  uint32_t m_queryMs;
+#endif
+  static Discovery *m_pThis;
+  void (*m_callback)(uint8_t peer);
+  Peer m_peer[PEER_CNT];
+  IPAddress m_newIP[PEER_CNT]; // found by the query, applied in service()
+  uint16_t m_newPort[PEER_CNT];
+  uint8_t m_pending;          // bits of m_newIP waiting
+  bool m_bStarted;
+};
+
+extern Discovery peers;
+
+#endif // DISCOVERY_H
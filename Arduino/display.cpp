@@ -8,8 +8,11 @@
 #include <ESP8266mDNS.h> // for WiFi.RSSI()
 #endif
 #include "eeMem.h"
+#include "schedule.h"
+#include "alarms.h"
 #include "tempArray.h"
 #include "music.h"
+#include "tasks.h"
 
 Nextion nex;
 extern Music mus;
@@ -23,11 +26,26 @@ void Display::init()
 {
   nex.FFF(); // Just to end any debug strings in the Nextion
   nex.reset();
+  if(m_tBacklight < 0)
+    m_tBacklight = tasks.add("backlight", backlightOff);
+  m_bInit = true;
   screen( true ); // brighten the screen if it just reset
   nex.autoWake(true);
+  tasks.start(m_tBacklight, NEX_TIMEOUT * 1000);
   refreshAll();
 }
 
+// the dimmer thing
+void Display::backlightOff()
+{
+  if(nex.getPage() != Page_Main) // wait until back on the main page
+  {
+    tasks.start(display.m_tBacklight, NEX_TIMEOUT * 1000);
+    return;
+  }
+  display.screen(false);
+}
+
 // called each second
 void Display::oneSec()
 {
@@ -35,11 +53,6 @@ void Display::oneSec()
   {
     refreshAll();    // time update every seconds
     updateRSSI();     //
-    if( m_backlightTimer ) // the dimmer thing
-    {
-      if(--m_backlightTimer == 0)
-        screen(false);
-    }
   }
   else if(nex.getPage() == Page_Clock)
   {
@@ -73,19 +86,19 @@ bool Display::checkNextion() // all the Nextion recieved commands
     case 0x65: // button
       bRtn = true; // anything pressed
       btn = cBuf[2];
-      if( m_backlightTimer == 0)
+      if( isOff() )
       {
         nex.brightness(NEX_BRIGHT); // backlight was off, ignore this input
-        m_backlightTimer = NEX_TIMEOUT;
+        tasks.start(m_tBacklight, NEX_TIMEOUT * 1000);
         return bRtn;
       }
       if(cBuf[3]) // press, not release
-        mus.add(6000, 20);
+        mus.add(6000, 20, true);
 
       switch(cBuf[1]) // page
       {
         case Page_Main:
-          m_backlightTimer = NEX_TIMEOUT;
+          tasks.start(m_tBacklight, NEX_TIMEOUT * 1000);
           switch(btn)
           {
             case 0: // screen (not used)
@@ -214,6 +227,7 @@ bool Display::checkNextion() // all the Nextion recieved commands
                 uint8_t alm = (btn-19)/7;
                 uint8_t bit = (btn-19)%7;
                 ee.alarm[alm].wday ^= 1 << bit;
+                alarms.update(now());
               }
               break;
             case 18: // Main
@@ -323,21 +337,34 @@ void Display::schedUpDown(bool bUp)
 {
   String s;
   uint8_t m;
+  uint8_t cnt = sched.count(m_season);
+  uint8_t n = m_schedTop + m_schedRow;
+
+  if(m_schedCol > 0 && m_schedCol < 5 && n >= cnt) // empty row
+    return;
+  Sched &item = sched.item(m_season, (n < cnt) ? n : 0);
 
   switch(m_schedCol)
   {
-    case 0: // name
+    case 0: // name (scroll the 5 rows)
+      if(bUp && m_schedTop)
+        m_schedTop--;
+      else if(!bUp && m_schedTop + 5 < cnt)
+        m_schedTop++;
+      else
+        break;
+      updateSchedule();
       break;
     case 1: // hour
-      ee.schedule[m_season][m_schedRow].timeSch += (bUp ? 60:-60);
-      ee.schedule[m_season][m_schedRow].timeSch %= 1440;
-      s = String(ee.schedule[m_season][m_schedRow].timeSch / 60) + ":";
+      item.timeSch += (bUp ? 60:-60);
+      item.timeSch %= 1440;
+      s = String(item.timeSch / 60) + ":";
       nex.itemText(m_schedRow + 5, s );
       break;
     case 2: // minute
-      ee.schedule[m_season][m_schedRow].timeSch += (bUp ? 1:-1);
-      ee.schedule[m_season][m_schedRow].timeSch %= 1440;
-      m = ee.schedule[m_season][m_schedRow].timeSch % 60;
+      item.timeSch += (bUp ? 1:-1);
+      item.timeSch %= 1440;
+      m = item.timeSch % 60;
       s = "";
       if(m < 10) s = "0";
       s += m;
@@ -346,26 +373,28 @@ void Display::schedUpDown(bool bUp)
     case 3: // temp
       nex.refreshItem("s0");
       delay(10); // was 6
-      ee.schedule[m_season][m_schedRow].setTemp += (bUp ? 1:-1);
-      ee.schedule[m_season][m_schedRow].setTemp = constrain(ee.schedule[m_season][m_schedRow].setTemp, 600, 900);
-      nex.itemText(m_schedRow + 15, String((float)ee.schedule[m_season][m_schedRow].setTemp/10, 1) );
+      item.setTemp += (bUp ? 1:-1);
+      item.setTemp = constrain(item.setTemp, 600, 900);
+      nex.itemText(m_schedRow + 15, String((float)item.setTemp/10, 1) );
       ta.draw();
       break;
     case 4: // thresh
 //      nex.refreshItem("s0");
-      ee.schedule[m_season][m_schedRow].thresh += (bUp ? 1:-1);
-      ee.schedule[m_season][m_schedRow].thresh %= 10;
-      nex.itemText(m_schedRow + 20, String(ee.schedule[m_season][m_schedRow].thresh) );
+      item.thresh += (bUp ? 1:-1);
+      item.thresh %= 10;
+      nex.itemText(m_schedRow + 20, String(item.thresh) );
 //      ta.draw();
       break;
     case 5: // all
       nex.refreshItem("s0");
       delay(10); // was 4
-      for(uint8_t i = 0; i < 5; i++)
+      for(uint8_t i = 0; i < cnt; i++)
       {
-        ee.schedule[m_season][i].setTemp += (bUp ? 1:-1);
-        ee.schedule[m_season][i].setTemp = constrain(ee.schedule[m_season][i].setTemp, 600, 900);
-        nex.itemText(i + 15, String((float)ee.schedule[m_season][i].setTemp/10, 1) );
+        Sched &it = sched.item(m_season, i);
+        it.setTemp += (bUp ? 1:-1);
+        it.setTemp = constrain(it.setTemp, 600, 900);
+        if(i >= m_schedTop && i < m_schedTop + 5)
+          nex.itemText(i - m_schedTop + 15, String((float)it.setTemp/10, 1) );
       }
       ta.draw();
       break;
@@ -460,18 +489,20 @@ void Display::buttonRepeat()
       else switch(sel)
       {
           case 0: // hour
-            ee.alarm[alm].timeSch -= 60;
+            ee.alarm[alm].timeSch += 24*60 - 60; // unsigned
             ee.alarm[alm].timeSch %= 24*60;
             break;
           case 1:
-            if(--ee.alarm[alm].timeSch < 0)
-              ee.alarm[alm].timeSch = 24*60 - 1;
+            if(ee.alarm[alm].timeSch == 0)
+              ee.alarm[alm].timeSch = 24*60;
+            ee.alarm[alm].timeSch--;
             break;
           case 2: // AM/PM
-            ee.alarm[alm].timeSch -= 12*60;
+            ee.alarm[alm].timeSch += 12*60;
             ee.alarm[alm].timeSch %= 24*60;
             break;
       }
+      alarms.update(now());
       switch(sel)
       {
         case 0: // hour
@@ -496,7 +527,7 @@ void Display::buttonRepeat()
     case Page_Schedule:
       break;
   }
-  mus.add(6000, 20);
+  mus.add(6000, 20, true);
 }
 
 String Display::fmtTime(uint16_t v)
@@ -518,20 +549,6 @@ String Display::fmtTime(uint16_t v)
   return s;
 }
 
-void Display::nextAlarm() // find next active alarm
-{
-  uint8_t tm = hour() * 60 + minute();
-
-  m_alarmIdx = 0;
-  for(int i = MAX_SCHED - 1; i >= 0; i--)
-  {
-    if(tm < ee.alarm[i].timeSch)
-      break;
-    if(ee.alarm[i].wday & (1 << weekday()) )
-      m_alarmIdx = i;
-  }
-}
-
 const char *_days_short[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
 const char *_mon[] = {"","JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
 
@@ -562,7 +579,6 @@ void Display::refreshAll()
     sTime += day();
     nex.itemText(2, sTime);
     nex.itemText(13, isPM() ? "PM":"AM");
-    nextAlarm();
   }
   sTime = "";
   if(second() < 10) sTime += "0";
@@ -589,12 +605,13 @@ void Display::refreshAll()
     save[4] = m_rh;
     nex.itemText(16, String((float)m_rh/10, 1) + "%" );
   }
-  if((bool)save[5] != m_bAlarmOn || m_alarmIdx != save[6])
+  int8_t alarmIdx = alarms.nextIdx();
+  if((bool)save[5] != m_bAlarmOn || alarmIdx != save[6])
   {
     save[5] = m_bAlarmOn;
-    save[6] = m_alarmIdx;
+    save[6] = alarmIdx;
     sTime = "ALARM ";
-    sTime += fmtTime(ee.alarm[m_alarmIdx].timeSch);
+    sTime += (alarmIdx < 0) ? String("--:--") : fmtTime(ee.alarm[alarmIdx].timeSch);
     sTime += m_bAlarmOn ? " ON " : " OFF";
     nex.itemText(3, sTime );
     nex.itemColor("t3", m_bAlarmOn ? rgb16(31,0,0):rgb16(15,0,31) );
@@ -634,22 +651,6 @@ void Display::refreshClock()
   
 }
 
-bool Display::checkAlarms()
-{
-  if(m_bAlarmOn == false)
-    return false;
-  uint16_t tm = (hour() * 60) + minute();
-  for(int i = 0; i < 5; i++)
-  {
-    if(ee.alarm[i].wday && ee.alarm[i].timeSch == tm)
-    {
-      if(ee.alarm[i].wday & 1<<day()) // check day bit
-        return true;
-    }
-  }
-  return false;
-}
-
 void Display::updateAlarms()
 {
   String s;
@@ -678,18 +679,33 @@ void Display::updateAlarms()
 
 void Display::updateSchedule()
 {
-  for(uint8_t i = 0; i < ee.schedCnt[m_season] && i < 5; i++)
+  uint8_t cnt = sched.count(m_season);
+
+  if(m_schedTop + 5 > cnt) // keep the window full
+    m_schedTop = (cnt > 5) ? cnt - 5 : 0;
+
+  for(uint8_t i = 0; i < 5; i++)
   {
-//    nex.itemText(i, ee.schedule[m_season][i].name );
-    nex.itemText(i+5, String(ee.schedule[m_season][i].timeSch / 60) + ":" );
-    uint8_t sec = ee.schedule[m_season][i].timeSch % 60;
+    uint8_t n = m_schedTop + i;
+    if(n >= cnt) // blank the unused rows
+    {
+      nex.itemText(i+5, "");
+      nex.itemText(i+10, "");
+      nex.itemText(i+15, "");
+      nex.itemText(i+20, "");
+      continue;
+    }
+    Sched &item = sched.item(m_season, n);
+//    nex.itemText(i, item.name );
+    nex.itemText(i+5, String(item.timeSch / 60) + ":" );
+    uint8_t sec = item.timeSch % 60;
     String s = "";
     if(sec < 10) s = "0";
     s += sec;
     nex.itemText(i+10, s );
-    nex.itemText(i+15, String((float)ee.schedule[m_season][i].setTemp/10, 1) );
-    nex.itemText(i+20, String(ee.schedule[m_season][i].thresh ) );
-    if(m_schInd == i)
+    nex.itemText(i+15, String((float)item.setTemp/10, 1) );
+    nex.itemText(i+20, String(item.thresh ) );
+    if(sched.dayItem(m_schInd) == n)
     {
       nex.backColor(String("t")+i, rgb16(12,20,8));
     }
@@ -709,7 +725,7 @@ void Display::updateLevel(uint8_t lvl)
 // false: switch to blank and dim
 bool Display::screen(bool bOn)
 {
-  if(WiFi.status() != WL_CONNECTED )
+  if(!m_bInit || WiFi.status() != WL_CONNECTED ) // the display boot stage hasn't run yet
     return false;
   static bool bOldOn = true;
 
@@ -719,7 +735,7 @@ bool Display::screen(bool bOn)
   if(bOn) // input or other reason
   {
     nex.brightness(NEX_BRIGHT);
-    m_backlightTimer = NEX_TIMEOUT; // update the auto backlight timer
+    tasks.start(m_tBacklight, NEX_TIMEOUT * 1000); // update the auto backlight timer
     if( bOn == bOldOn )
       return false; // no change occurred
     if(nex.getPage())
@@ -744,7 +760,7 @@ bool Display::screen(bool bOn)
 // return true if backlight is off
 bool Display::isOff()
 {
-  return (m_backlightTimer == 0) ? true:false;
+  return m_bInit && !tasks.active(m_tBacklight);
 }
 
 void Display::updateRSSI()
@@ -27,7 +27,6 @@ public:
   bool checkNextion(void); // all the Nextion recieved commands
   bool isOff(void);
   void updateLevel(uint8_t lvl);
-  bool checkAlarms(void);
   void Notification(String s, IPAddress ip);
   void NotificationCancel(String s);
 
@@ -50,7 +49,6 @@ public:
 
 private:
   void buttonRepeat(void);
-  void nextAlarm(void);
   void refreshAll(void);
   void refreshClock(void);
   void updateRSSI(void);
@@ -59,15 +57,17 @@ private:
   void updateSchedule(void);
   void selectSched(uint8_t row, uint8_t col);
   void schedUpDown(bool bUp);
+  static void backlightOff(void);
 
-  uint16_t m_backlightTimer = NEX_TIMEOUT;
+  int8_t m_tBacklight = -1; // task that turns the backlight off
+  bool   m_bInit = false;   // init() has run, the boot stages start it after the heater
   uint8_t m_btnMode = 0;
   uint8_t m_btnDelay = 0;
   bool  m_bSliderDn = false;
   uint8_t m_almSelect =0;
   uint8_t m_schedRow =0;
   uint8_t m_schedCol = 0;
-  uint8_t m_alarmIdx = 0;
+  uint8_t m_schedTop = 0; // first schedule row shown
   IPAddress m_notifIP;
 #define NOTIFS 10
   Notif m_Notif[NOTIFS];
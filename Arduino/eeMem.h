@@ -2,24 +2,28 @@
 #define EEMEM_H
 
 #include <Arduino.h>
+#include "settings.h"
 
 struct Sched
 {
   uint16_t setTemp;
   uint16_t timeSch;
   uint8_t thresh;
-  uint8_t wday;  // Todo: weekday 0=any, 1-7 = day of week
+  uint8_t wday;  // weekday 0=any, bits 0-6 = day of week
 };
 
 struct Alarm
 {
-  uint16_t ms;  // 0 = inactive
-  uint16_t freq;
+  uint16_t ms;    // beep length, 0 = 500ms
+  uint16_t freq;  // 0 = 3000Hz
   uint16_t timeSch;
-  uint8_t  wday;  // Todo: weekday 0=any, bits 0-6 = day of week
+  uint8_t  wday;  // bits 0-6 = Sun-Sat, 0 = off
+  uint8_t  song;  // song+1 for the last stage, 0 = beeps
 };
 
-#define MAX_SCHED 8
+#define MAX_SCHED  48 // entries per season
+#define SCHED_POOL 64 // entries for all seasons
+#define MAX_ALARM   8
 
 #define EESIZE (offsetof(eeMem, end) - offsetof(eeMem, size) )
 
@@ -37,58 +41,33 @@ public:
   uint16_t sum = 0xAAAA;           // if sum is diiferent from memory struct, write
   char     szSSID[32] = "";
   char     szSSIDPassword[64] = "";
-  uint16_t vacaTemp = 700;     // vacation temp
-  int8_t  tz = -5;            // Timezone offset from your global server
-  uint8_t schedCnt[4] = {5,5,5,5};   // number of active scedules
-  bool    bVaca = false;         // vacation enabled
-  bool    bAvg = true;          // average target between schedules
-  bool    bEco = false;          // eco mode
+#define EE_SETTING(t, m, d, c, j, k, lo, hi, fn) t m = d;
+  SETTINGS(EE_SETTING)  // settings.h
+  uint8_t schedCnt[4] = {5,5,5,5};   // entries used by each season in schedule[]
   uint16_t scheduleDays[4] = {77, 155, 171, 355}; // Spring, Summer, Fall, Winter
-  Sched   schedule[4][MAX_SCHED] =  // 2x22x8 bytes
+  Sched   schedule[SCHED_POOL] =  // 6x64 bytes, seasons packed in order
   {
-    {
-      {831,  3*60, 3, 0},
-      {824,  6*60, 2, 0},  // temp, time, thresh, wday
-      {819,  8*60, 3, 0},
-      {819, 16*60, 3, 0},
-      {834, 21*60, 3, 0},
-      {830,  0*60, 3, 0},
-      {830,  0*60, 3, 0},
-      {830,  0*60, 3, 0}
-    },
-    {
-      {831,  3*60, 3, 0},
-      {824,  6*60, 2, 0},  // temp, time, thresh, wday
-      {819,  8*60, 3, 0},
-      {819, 16*60, 3, 0},
-      {834, 21*60, 3, 0},
-      {830,  0*60, 3, 0},
-      {830,  0*60, 3, 0},
-      {830,  0*60, 3, 0}
-    },
-    {
-      {831,  3*60, 3, 0},
-      {824,  6*60, 2, 0},  // temp, time, thresh, wday
-      {819,  8*60, 3, 0},
-      {819, 16*60, 3, 0},
-      {834, 21*60, 3, 0},
-      {830,  0*60, 3, 0},
-      {830,  0*60, 3, 0},
-      {830,  0*60, 3, 0}
-    },
-    {
-      {831,  3*60, 3, 0},
-      {824,  6*60, 2, 0},  // temp, time, thresh, wday
-      {819,  8*60, 3, 0},
-      {819, 16*60, 3, 0},
-      {834, 21*60, 3, 0},
-      {830,  0*60, 3, 0},
-      {830,  0*60, 3, 0},
-      {830,  0*60, 3, 0}
-    },  };
-  uint16_t ppkwh = 154; // $0.154 / KWH
-  uint16_t rate = 50; // seconds
-  uint16_t watts = 290; // Heating pad
+    {831,  3*60, 3, 0},  // Spring
+    {824,  6*60, 2, 0},  // temp, time, thresh, wday
+    {819,  8*60, 3, 0},
+    {819, 16*60, 3, 0},
+    {834, 21*60, 3, 0},
+    {831,  3*60, 3, 0},  // Summer
+    {824,  6*60, 2, 0},
+    {819,  8*60, 3, 0},
+    {819, 16*60, 3, 0},
+    {834, 21*60, 3, 0},
+    {831,  3*60, 3, 0},  // Fall
+    {824,  6*60, 2, 0},
+    {819,  8*60, 3, 0},
+    {819, 16*60, 3, 0},
+    {834, 21*60, 3, 0},
+    {831,  3*60, 3, 0},  // Winter
+    {824,  6*60, 2, 0},
+    {819,  8*60, 3, 0},
+    {819, 16*60, 3, 0},
+    {834, 21*60, 3, 0},
+  };
   uint32_t tSecsMon[12] = {1254411,1067144,916519,850686,122453,268488,302535,396531,501161,552347,427980,883172}; // total secwatt hours per month (copied from page)
   int16_t  tAdj[2] = {0,0};
   int16_t  pids[3] = {60*3,60*1, 5}; // Todo: real PID
@@ -101,13 +80,16 @@ public:
   uint16_t resPort = 80;
   uint32_t nOvershootTime;
   int16_t  nOvershootTempDiff;
-  Alarm   alarm[MAX_SCHED] = 
+  Alarm   alarm[MAX_ALARM] = 
   { // alarms
     {0, 1000, 8*60, 0x3E},
     {0},
   };
+  uint8_t  bssid[6];     // last AP, for a fast connect
+  uint8_t  channel;      // 0 = unknown
+  uint8_t  ipCfg[4][4];  // IP, gateway, mask, DNS. Last lease, or static with bStaticIP
   uint8_t end;
-}; // 470
+}; // 689
 
 extern eeMem ee;
 #endif // EEMEM_H
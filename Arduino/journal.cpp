@@ -0,0 +1,125 @@
+#include "journal.h"
+#include "wsTopics.h"
+#include "eeMem.h" // for jsonString
+#include "jsonstring.h"
+
+static const char *typeName[] = {"alert", "heat", "setpoint", "presence", "notif", "set"};
+
+void Journal::begin(uint32_t (*pClock)(void))
+{
+  m_pClock = pClock;
+#ifdef ESP32
+  m_boot = esp_random() | 1;
+#else
+  m_boot = ESP.random() | 1;
+#endif
+}
+
+void Journal::add(uint8_t type, int16_t v, const char *pText)
+{
+  uint32_t seq = m_seq + 1;
+  jnEvent &last = m_ev[(m_evCnt - 1) % JN_CNT];
+
+  if (type == JE_ALERT && m_evCnt && last.seq == m_seq && last.type == type && last.v == v
+    && !strncmp(last.szText, pText ? pText : "", JN_TEXT - 1))
+  {
+    m_repeats++; // a repeating alert would push out everything else
+    return;
+  }
+
+  jnEvent *pe;
+
+  if (isState(type))
+    pe = &m_st[m_stCnt++ % JN_STATE];
+  else
+  {
+    pe = &m_ev[m_evCnt++ % JN_CNT];
+    if (m_evCnt > JN_CNT)
+      m_lost = pe->seq;
+  }
+
+  jnEvent &e = *pe;
+
+  e.seq = seq;
+  e.t = m_pClock ? m_pClock() : 0;
+  e.v = v;
+  e.type = type;
+  e.szText[0] = 0;
+  if (pText)
+  {
+    strncpy(e.szText, pText, JN_TEXT - 1);
+    e.szText[JN_TEXT - 1] = 0;
+  }
+  m_seq = seq;
+  m_cnt[type]++;
+  topics.publish(TP_EVENT, json(e, false), true);
+}
+
+uint8_t Journal::resume(uint32_t id, uint32_t boot, uint32_t seq)
+{
+  uint32_t last = m_seq;
+
+  if (boot != m_boot || seq > last || seq < m_lost)
+  {
+    m_full++;
+    return JR_FULL;
+  }
+
+  uint8_t r = JR_OK;
+  uint32_t i = (m_evCnt > JN_CNT) ? m_evCnt - JN_CNT : 0;
+  uint32_t j = (m_stCnt > JN_STATE) ? m_stCnt - JN_STATE : 0;
+
+  while (i < m_evCnt && m_ev[i % JN_CNT].seq <= seq)
+    i++;
+  while (j < m_stCnt && m_st[j % JN_STATE].seq <= seq)
+    j++;
+
+  while (i < m_evCnt || j < m_stCnt) // both rings in seq order, state events that are gone are skipped
+  {
+    jnEvent &e = (j >= m_stCnt || (i < m_evCnt && m_ev[i % JN_CNT].seq < m_st[j % JN_STATE].seq))
+      ? m_ev[i++ % JN_CNT] : m_st[j++ % JN_STATE];
+    topics.sendTo(id, json(e, true));
+    m_replayed++;
+    if (e.type == JE_SET)
+      r = JR_SET;
+  }
+  m_resumed++;
+  return r;
+}
+
+String Journal::json(jnEvent &e, bool bReplay)
+{
+  jsonString js("event");
+
+  js.Var("seq", e.seq);
+  js.Var("t", e.t);
+  js.Var("type", typeName[e.type]);
+  js.Var("v", e.v);
+  if (e.szText[0])
+    js.Var("data", e.szText);
+  if (bReplay)
+    js.Var("re", 1);
+  return js.Close();
+}
+
+String Journal::headJson() // where a client is, send after it's caught up
+{
+  jsonString js("journal");
+
+  js.Var("boot", m_boot);
+  js.Var("seq", (uint32_t)m_seq);
+  return js.Close();
+}
+
+String Journal::statsJson()
+{
+  jsonString js;
+
+  js.Var("seq", (uint32_t)m_seq);
+  js.Array("types", m_cnt, JE_CNT); // alert, heat, setpoint, presence, notif, set
+  js.Var("resumed", m_resumed);
+  js.Var("replayed", m_replayed);
+  js.Var("full", m_full);
+  js.Var("repeats", m_repeats);
+  return js.Close();
+}
@@ -0,0 +1,75 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <Arduino.h>
+#include <atomic>
+
+#define JN_CNT   32  // alerts, notifications and setting changes kept
+#define JN_STATE 16  // heat, setpoint and presence events kept, in their own ring
+#define JN_TEXT  40  // max text, longer is cut
+
+enum jnType
+{
+  JE_ALERT,
+  JE_HEAT,     // v = heater on
+  JE_SETPOINT, // v = target x10
+  JE_PRESENCE, // v = PE_ event
+  JE_NOTIF,    // v = 1 shown, 0 cancelled
+  JE_SET,      // settings or schedule changed
+  JE_CNT
+};
+
+enum jnResume
+{
+  JR_OK,   // sent what was missed
+  JR_SET,  // and the settings changed in that time
+  JR_FULL, // other boot or too far back, needs everything
+};
+
+struct jnEvent
+{
+  uint32_t seq;
+  uint32_t t;
+  int16_t  v;
+  uint8_t  type;
+  char     szText[JN_TEXT];
+};
+
+// Recent events with a sequence number, published on the "event" topic.  A websocket client that
+// reconnects with /ws?boot=&seq= gets the ones after seq instead of everything again.
+// State events go in a ring of their own so they can't push out alerts.  The client gets the
+// current state on connect anyway, so a resume only needs everything when a kept event is gone.
+// An alert repeating the last event isn't kept again, every other event is.  Call from loop() only, except head()
+class Journal
+{
+public:
+  Journal(){}
+  void begin(uint32_t (*pClock)(void)); // UTC for the times
+  void add(uint8_t type, int16_t v, const char *pText = NULL);
+  uint8_t resume(uint32_t id, uint32_t boot, uint32_t seq);
+  uint32_t boot(void){ return m_boot; }
+  uint32_t head(void){ return m_seq; } // last seq, any task
+  String headJson(void);
+  String statsJson(void);
+private:
+  String json(jnEvent &e, bool bReplay);
+  static bool isState(uint8_t type){ return type == JE_HEAT || type == JE_SETPOINT || type == JE_PRESENCE; }
+
+  jnEvent  m_ev[JN_CNT];
+  jnEvent  m_st[JN_STATE];
+  uint32_t m_evCnt;    // written to each ring
+  uint32_t m_stCnt;
+  uint32_t m_lost;     // seq of the newest event pushed out of m_ev
+  std::atomic<uint32_t> m_seq{0};
+  uint32_t m_boot;
+  uint32_t (*m_pClock)(void);
+  uint32_t m_cnt[JE_CNT];
+  uint32_t m_resumed;
+  uint32_t m_replayed;
+  uint32_t m_full;
+  uint32_t m_repeats;
+};
+
+extern Journal journal;
+
+#endif // JOURNAL_H
@@ -149,26 +149,21 @@ public:
   }
 
  // custom arrays for waterbed
-  void Array(const char *key, Sched sVal[][MAX_SCHED], int n)
+  void Array(const char *key, Sched sVal[], int n)
   {
     if(m_cnt) s += ",";
     s += "\"";
     s += key;
     s += "\":[";
 
-    for(int i2 = 0; i2 < n; i2++)
+    for(int i = 0; i < n; i++)
     {
-      if(i2) s += ",";
+      if(i) s += ",";
       s += "[";
-      for(int i = 0; i < MAX_SCHED; i++)
-      {
-        if(i) s += ",";
-        s += "[";
-        s += sVal[i2][i].timeSch;
-        s += ","; s += String( (float)sVal[i2][i].setTemp/10, 1 );
-        s += ","; s += String( (float)sVal[i2][i].thresh/10,1 );
-        s += "]";
-      }
+      s += sVal[i].timeSch;
+      s += ","; s += String( (float)sVal[i].setTemp/10, 1 );
+      s += ","; s += String( (float)sVal[i].thresh/10,1 );
+      s += ","; s += sVal[i].wday;
       s += "]";
     }
     s += "]";
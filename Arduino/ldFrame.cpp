@@ -0,0 +1,108 @@
+#include "ldFrame.h"
+
+static const uint8_t ldHead[4] = {0xF4, 0xF3, 0xF2, 0xF1};
+static const uint8_t ldTail[4] = {0xF8, 0xF7, 0xF6, 0xF5};
+
+enum ldState
+{
+  LS_HEAD,  // m_pos = header bytes matched
+  LS_LEN,
+  LS_DATA,
+  LS_TAIL,
+};
+
+bool LdFrame::feed(uint8_t c)
+{
+  switch(m_state)
+  {
+    case LS_HEAD:
+      if(c == ldHead[m_pos])
+      {
+        if(++m_pos == 4)
+        {
+          m_state = LS_LEN;
+          m_pos = 0;
+          m_len = 0;
+        }
+      }
+      else
+        m_pos = (c == ldHead[0]) ? 1 : 0;
+      break;
+    case LS_LEN:
+      m_len |= c << (m_pos * 8);
+      if(++m_pos < 2)
+        break;
+      m_pos = 0;
+      if(m_len < 13 || m_len > LD_MAXLEN)
+      {
+        m_bad++;
+        m_state = LS_HEAD;
+      }
+      else
+        m_state = LS_DATA;
+      break;
+    case LS_DATA:
+      m_buf[m_pos++] = c;
+      if(m_pos == m_len)
+      {
+        m_pos = 0;
+        m_state = LS_TAIL;
+      }
+      break;
+    case LS_TAIL:
+      if(c != ldTail[m_pos])
+      {
+        m_bad++;
+        m_pos = 0;
+        m_state = LS_HEAD;
+        break;
+      }
+      if(++m_pos < 4)
+        break;
+      m_pos = 0;
+      m_state = LS_HEAD;
+      if(parse())
+      {
+        m_frames++;
+        return true;
+      }
+      m_bad++;
+      break;
+  }
+  return false;
+}
+
+bool LdFrame::parse()
+{
+  uint8_t *p = m_buf;
+
+  if((p[0] != 1 && p[0] != 2) || p[1] != 0xAA || p[m_len - 2] != 0x55)
+    return false;
+
+  radarSample &s = m_s;
+  uint8_t t = p[2];
+  s.bPresence = (t != LD_NONE);
+  s.bMoving = (t & LD_MOVING) ? true : false;
+  s.bStationary = (t & LD_STATIONARY) ? true : false;
+  s.movDist = p[3] | (p[4] << 8);
+  s.movEnergy = p[5];
+  s.statDist = p[6] | (p[7] << 8);
+  s.statEnergy = p[8];
+  s.detDist = p[9] | (p[10] << 8);
+  s.gates = 0;
+
+  if(p[0] != 1) // basic frame
+    return true;
+
+  uint8_t nMov = p[11] + 1;
+  uint8_t nStat = p[12] + 1;
+  if(nMov > LD_GATES || nStat > LD_GATES || 13 + nMov + nStat + 2 > m_len)
+    return false;
+
+  memset(s.movGate, 0, sizeof(s.movGate));
+  memset(s.statGate, 0, sizeof(s.statGate));
+  memcpy(s.movGate, p + 13, nMov);
+  memcpy(s.statGate, p + 13 + nMov, nStat);
+  s.gates = max(nMov, nStat);
+  return true;
+}
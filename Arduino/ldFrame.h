@@ -0,0 +1,55 @@
+#ifndef LDFRAME_H
+#define LDFRAME_H
+
+#include <Arduino.h>
+
+#define LD_GATES    9     // 0-8, 0.75m each at the default resolution
+#define LD_GATE_CM  75
+#define LD_MAXLEN   64    // longest payload accepted
+
+enum ldTarget
+{
+  LD_NONE,
+  LD_MOVING,
+  LD_STATIONARY,
+  LD_BOTH,
+};
+
+struct radarSample
+{
+  uint32_t ms;
+  bool     bPresence;
+  bool     bMoving;
+  bool     bStationary;
+  uint8_t  movEnergy;
+  uint8_t  statEnergy;
+  uint16_t movDist;   // cm
+  uint16_t statDist;
+  uint16_t detDist;
+  uint8_t  gates;     // entries in movGate/statGate, 0 = basic frame
+  uint8_t  movGate[LD_GATES];  // per gate energy 0-100, engineering mode
+  uint8_t  statGate[LD_GATES];
+};
+
+// Byte at a time parser for the LD2410 report frames, basic and engineering mode.
+// F4 F3 F2 F1, len16, type, AA, target data, [gate energies], 55, 00, F8 F7 F6 F5
+// Command ACKs (FD FC FB FA) are skipped while it hunts for a header
+class LdFrame
+{
+public:
+  LdFrame(){}
+  bool feed(uint8_t c); // true when m_s holds a new frame
+
+  radarSample m_s;
+  uint32_t m_frames;
+  uint32_t m_bad;
+private:
+  bool parse(void);
+
+  uint8_t  m_buf[LD_MAXLEN];
+  uint16_t m_len;
+  uint16_t m_pos;
+  uint8_t  m_state;
+};
+
+#endif // LDFRAME_H
@@ -0,0 +1,96 @@
+#include "monoTime.h"
+#ifdef ESP32
+#include <esp_timer.h>
+#endif
+
+uint64_t monoMs()
+{
+#ifdef ESP32
+  return esp_timer_get_time() / 1000;
+#else
+  return micros64() / 1000;
+#endif
+}
+
+void MonoTimer::start(uint32_t ms, bool bRepeat)
+{
+  m_period = ms;
+  m_bRepeat = bRepeat;
+  m_due = monoMs() + ms;
+  m_bRun = true;
+}
+
+void MonoTimer::stop()
+{
+  m_bRun = false;
+}
+
+bool MonoTimer::running()
+{
+  return m_bRun;
+}
+
+bool MonoTimer::expired()
+{
+  if(!m_bRun)
+    return false;
+  uint64_t ms = monoMs();
+  if(ms < m_due)
+    return false;
+  if(!m_bRepeat)
+    m_bRun = false;
+  else if(ms - m_due >= m_period) // fell behind, skip the missed ones
+    m_due = ms + m_period;
+  else
+    m_due += m_period; // no drift
+  return true;
+}
+
+uint32_t MonoTimer::remaining()
+{
+  uint64_t ms = monoMs();
+  return (!m_bRun || ms >= m_due) ? 0 : m_due - ms;
+}
+
+// Call about once a second with now() and monoMs().  A minute already done isn't repeated.
+// After a step forward only the new minute runs, so WC_HALF and WC_HOUR say a boundary was
+// passed and that work isn't lost.  tools/clockSteps.cpp tests this on a PC
+uint8_t WallClock::tick(time_t t, uint64_t ms)
+{
+  int64_t off = (int64_t)t * 1000 - (int64_t)ms;
+  uint32_t minute = t / 60;
+  uint8_t ret = 0;
+  bool bSet = false;
+
+  if(!m_bInit)
+  {
+    m_bInit = true;
+    m_minute = minute - 1;
+  }
+  else
+  {
+    int64_t step = off - m_off;
+    if(step > WC_STEP_MS || step < -WC_STEP_MS)
+    {
+      ret = WC_JUMP;
+      m_lastStep = step / 1000;
+      m_steps++;
+      if(step < -(int64_t)WC_REPEAT * 1000)
+        m_minute = minute - 1;
+      else if(step > (int64_t)WC_SET * 1000) // first time from NTP, nothing was skipped
+        bSet = true;
+    }
+  }
+  m_off = off;
+
+  if((int32_t)(minute - m_minute) > 0)
+  {
+    if(!bSet && minute / 30 != m_minute / 30)
+      ret |= WC_HALF;
+    if(!bSet && minute / 60 != m_minute / 60)
+      ret |= WC_HOUR;
+    m_minute = minute;
+    ret |= WC_MINUTE;
+  }
+  return ret;
+}
@@ -0,0 +1,50 @@
+#ifndef MONOTIME_H
+#define MONOTIME_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// Control timing runs on monoMs(), 64 bit milliseconds since boot that never wrap or jump.
+// Wall clock time (now()) is only for schedules, and WallClock says when it was stepped.
+
+uint64_t monoMs(void);
+
+class MonoTimer
+{
+public:
+  MonoTimer(){}
+  void start(uint32_t ms, bool bRepeat = false);
+  void stop(void);
+  bool running(void);
+  bool expired(void); // true once when due. Repeating timers don't burst to catch up
+  uint32_t remaining(void);
+private:
+  uint64_t m_due;
+  uint32_t m_period;
+  bool m_bRepeat;
+  bool m_bRun;
+};
+
+#define WC_MINUTE  1  // a new minute, run the per minute work
+#define WC_JUMP    2  // the clock was stepped, recompute anything based on it
+#define WC_HALF    4  // a half hour boundary was reached or stepped over since the last minute
+#define WC_HOUR    8  // the same for an hour
+
+#define WC_STEP_MS 2000   // a change larger than this from the monotonic clock is a step
+#define WC_REPEAT  (5*60) // stepped back further than this (DST), run the repeated minutes again
+#define WC_SET     (24*60*60) // stepped forward further than this, the clock was set, not corrected
+
+class WallClock
+{
+public:
+  WallClock(){}
+  uint8_t tick(time_t t, uint64_t ms);
+  int32_t m_lastStep; // seconds
+  uint16_t m_steps;
+private:
+  int64_t  m_off;     // wall - monotonic ms
+  uint32_t m_minute;  // last minute that had its work done
+  bool     m_bInit;
+};
+
+#endif // MONOTIME_H
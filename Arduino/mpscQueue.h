@@ -0,0 +1,81 @@
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Bounded multi producer, single consumer queue.  Any task can push(), only one pops.
+// Each cell has a sequence number so producers claim slots with one compare-exchange and
+// the consumer sees a cell only after it is filled.  N must be a power of 2
+template <class T, uint16_t N>
+class MpscQueue
+{
+  static_assert((N & (N - 1)) == 0, "N must be a power of 2");
+public:
+  MpscQueue()
+  {
+    for(uint16_t i = 0; i < N; i++)
+      m_cell[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  // n entries are kept together, so a batch is never split by another producer.
+  // reserve cells past them have to be free too, left for pushes without a reserve
+  bool push(const T *p, uint16_t n = 1, uint16_t reserve = 0)
+  {
+    if(n == 0 || n + reserve > N)
+      return false;
+    uint32_t pos = m_head.load(std::memory_order_relaxed);
+
+    for(;;)
+    {
+      // the consumer frees cells in order, so if the last one is free they all are
+      uint32_t last = pos + n - 1 + reserve;
+      uint32_t seq = m_cell[last % N].seq.load(std::memory_order_acquire);
+      int32_t diff = (int32_t)(seq - last);
+
+      if(diff < 0) // full
+      {
+        m_drops.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      if(diff == 0 && m_head.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed))
+        break;
+      if(diff > 0)
+        pos = m_head.load(std::memory_order_relaxed);
+    }
+
+    for(uint16_t i = 0; i < n; i++)
+    {
+      Cell &c = m_cell[(pos + i) % N];
+      c.data = p[i];
+      c.seq.store(pos + i + 1, std::memory_order_release);
+    }
+    return true;
+  }
+
+  bool pop(T &v) // consumer
+  {
+    Cell &c = m_cell[m_tail % N];
+
+    if((int32_t)(c.seq.load(std::memory_order_acquire) - (m_tail + 1)) < 0)
+      return false; // empty or still being filled
+    v = c.data;
+    c.seq.store(m_tail + N, std::memory_order_release);
+    m_tail++;
+    return true;
+  }
+
+  std::atomic<uint32_t> m_drops{0}; // producers on any task
+
+private:
+  struct Cell
+  {
+    std::atomic<uint32_t> seq;
+    T data;
+  };
+  Cell m_cell[N];
+  std::atomic<uint32_t> m_head{0};
+  uint32_t m_tail = 0;
+};
+
+#endif // MPSCQUEUE_H
@@ -7,11 +7,11 @@ extern void WsPrint(String s);
 // !!negative numbers are used to represent dotted notes,
 // so -4 means a dotted quarter note, that is, a quarter plus an eighteenth!!
 
-const int melody_dingdong[] = {
+const int16_t melody_dingdong[] PROGMEM = {
   NOTE_B4, 8, NOTE_G4, 4
 };
 
-const int melody_pacman[] = {
+const int16_t melody_pacman[] PROGMEM = {
   // Pacman
   // Score available at https://musescore.com/user/85429/scores/107109
   NOTE_B4, 16, NOTE_B5, 16, NOTE_FS5, 16, NOTE_DS5, 16, //1
@@ -23,7 +23,7 @@ const int melody_pacman[] = {
   NOTE_F5, 32,  NOTE_FS5, 32,  NOTE_G5, 32,  NOTE_G5, 32, NOTE_GS5, 32,  NOTE_A5, 16, NOTE_B5, 8
 };
 
-const int melody_PinkPanther[] = {
+const int16_t melody_PinkPanther[] PROGMEM = {
 
   // Pink Panther theme
   // Score available at https://musescore.com/benedictsong/the-pink-panther
@@ -49,7 +49,7 @@ const int melody_PinkPanther[] = {
   NOTE_G4,-16, NOTE_E4,-16, NOTE_D4,-16, NOTE_E4,16, NOTE_E4,16, NOTE_E4,2,
  
 };
-const int melody_keyboardCat[] = {
+const int16_t melody_keyboardCat[] PROGMEM = {
 
   // Keyboard cat
   // Score available at https://musescore.com/user/142788/scores/147371
@@ -73,7 +73,7 @@ const int melody_keyboardCat[] = {
     NOTE_G3,-1, 
 };
 
-const int melody_Nokia[] = {
+const int16_t melody_Nokia[] PROGMEM = {
 
   // Nokia Ringtone 
   // Score available at https://musescore.com/user/29944637/scores/5266155
@@ -84,7 +84,7 @@ const int melody_Nokia[] = {
   NOTE_A4, 2, 
 };
 
-const int melody_imperial[] = {
+const int16_t melody_imperial[] PROGMEM = {
   
   // Dart Vader theme (Imperial March) - Star wars 
   // Score available at https://musescore.com/user/202909/scores/1141521
@@ -112,134 +112,141 @@ const int melody_imperial[] = {
   
 };
 
+struct songDef
+{
+  const int16_t *pNotes;
+  uint16_t notes;
+  uint8_t  tempo;
+};
+
+#define SONG(m, t) {m, sizeof(m) / sizeof(m[0]) / 2, t}
+
+static const songDef songs[] = {
+  SONG(melody_dingdong, 60),
+  SONG(melody_pacman, 105),
+  SONG(melody_PinkPanther, 120),
+  SONG(melody_imperial, 120),
+  SONG(melody_Nokia, 180),
+};
+
+// PWM duty for each envelope step, the last is held
+static const uint8_t envelope[] = {30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4};
+
 void Music::init()
 {
   pinMode(SPEAKER, OUTPUT);
   digitalWrite(SPEAKER, LOW);
+  m_ticker.attach_ms(MUS_TICK, tick, this);
 }
 
-bool Music::add(uint16_t note, uint16_t delay)
+bool Music::add(uint16_t note, uint16_t delay, bool bNow)
 {
-  if(m_bPlaying)
-  {
-    if(m_idx >= MUS_LEN)
-      return false;
-    m_arr[m_idx].note = note;
-    m_arr[m_idx].ms = delay;
-    m_idx++;
-  }
-  else
-  {
-    playNote(note, delay);
-    m_bPlaying = true;
-  }
-  return true;
+  musicArr n;
+
+  n.note = note;
+  n.ms = delay;
+  return bNow ? m_nowq.push(n) : m_q.push(n);
 }
 
-void Music::playNote(int note, int duration)
+bool Music::playing()
 {
-    if(note)
-    {
-#ifdef ESP32
-      analogWriteFrequency(SPEAKER, note);
-#else
-      analogWriteFreq(note);
-#endif
-      analogWrite(SPEAKER, m_volume = 30);
-    }
-    else
-    {
-      analogWrite(SPEAKER, 0);
-      m_volume = 0;
-    } 
-    m_toneEnd = millis() + duration;
+  return m_bPlaying || m_pSong || m_songReq || !m_q.empty();
 }
 
+// starts a song unless one is already playing
 bool Music::play(int song)
 {
-  int tempo = 100;
-  int notes;
-  const int *pSong;
+  if(song < 0 || song >= (int)(sizeof(songs) / sizeof(songs[0])) || m_pSong || m_songReq)
+    return false;
+  m_songReq = song + 1;
+  return true;
+}
+
+void Music::tick(Music *pThis)
+{
+  pThis->onTick();
+}
+
+void Music::onTick()
+{
+  musicArr n;
 
-  switch(song)
+  if(m_nowq.pop(n))
   {
-    case 0:
-      tempo = 60;
-      notes = sizeof(melody_dingdong) / sizeof(melody_dingdong[0]) / 2;
-      pSong = melody_dingdong;
-      break;
-    case 1:
-      tempo = 105;
-      notes = sizeof(melody_pacman) / sizeof(melody_pacman[0]) / 2;
-      pSong = melody_pacman;
-      break;
-    case 2:
-      tempo = 120;
-      notes = sizeof(melody_PinkPanther) / sizeof(melody_PinkPanther[0]) / 2;
-      pSong = melody_PinkPanther;
-      break;
-    case 3:
-      tempo = 120;
-      notes = sizeof(melody_imperial) / sizeof(melody_imperial[0]) / 2;
-      pSong = melody_imperial;
-      break;
-    case 4:
-      tempo = 180;
-      notes = sizeof(melody_Nokia) / sizeof(melody_Nokia[0]) / 2;
-      pSong = melody_Nokia;
-      break;
-    default:
-      return false;
+    playNote(n);
+    return;
   }
-  if(notes >= MUS_LEN - m_idx)
-    notes = MUS_LEN - m_idx;
-
-  // this calculates the duration of a whole note in ms
-  int wholenote = (60000 * 4) / tempo;
-  int divider = 0, noteDuration = 0;
 
-  for (int thisNote = 0; thisNote < notes * 2; thisNote = thisNote + 2)
+  if(m_bPlaying)
   {
-    // calculates the duration of each note
-    divider = pSong[thisNote + 1];
-    if (divider > 0) {
-      // regular note, just proceed
-      noteDuration = (wholenote) / divider;
-    } else if (divider < 0) {
-      // dotted notes are represented with negative durations!!
-      noteDuration = (wholenote) / abs(divider);
-      noteDuration *= 1.5; // increases the duration in half for dotted notes
+    if(--m_ticksLeft)
+    {
+      if(++m_envTick >= MUS_DECAY)
+      {
+        m_envTick = 0;
+        if(m_env < sizeof(envelope) - 1)
+          analogWrite(SPEAKER, envelope[++m_env]);
+      }
+      return;
     }
+    analogWrite(SPEAKER, 0);
+    m_bPlaying = false;
+  }
 
-    // we only play the note for 90% of the duration, leaving 10% as a pause
-    add(pSong[thisNote], noteDuration * 0.9);
+  uint8_t req = m_songReq;
+  if(req && m_pSong == NULL)
+  {
+    const songDef &s = songs[req - 1];
+    m_pSong = s.pNotes;
+    m_songNotes = s.notes;
+    m_songPos = 0;
+    m_wholeNote = (60000 * 4) / s.tempo; // the duration of a whole note in ms
+    m_songReq = 0;
   }
-  return true;
+
+  if(nextNote(n))
+    playNote(n);
 }
 
-void Music::service()
+void Music::playNote(const musicArr &n)
 {
-  if(m_bPlaying == false)
-    return;
-  else if(millis() >= m_toneEnd)
+  if(n.note)
   {
-    analogWrite(SPEAKER, 0);
-    m_toneEnd = 0;
-    m_bPlaying = false;
+    uint16_t f = n.note;
+#ifdef ESP32
+    analogWriteFrequency(SPEAKER, f);
+#else
+    if(f < MUS_MIN_FREQ)
+      f = MUS_MIN_FREQ;
+    analogWriteFreq(f);
+#endif
+    analogWrite(SPEAKER, envelope[0]);
   }
   else
-  {
-    if(m_volume > 2)
-    {
-      analogWrite(SPEAKER, m_volume);
-      m_volume -= 2;
-    }
-    return;
-  }
-  if(m_idx <= 0)
-    return;
-  playNote(m_arr[0].note, m_arr[0].ms);
-  memcpy(m_arr, m_arr + 1, sizeof(musicArr) * MUS_LEN);
-  m_idx--;
+    analogWrite(SPEAKER, 0);
+
+  m_env = n.note ? 0 : sizeof(envelope) - 1; // a rest doesn't step
+  m_envTick = 0;
+  m_ticksLeft = max((n.ms + MUS_TICK - 1) / MUS_TICK, 1);
   m_bPlaying = true;
 }
+
+// queued notes first, then the next note of the song, decoded when it's needed
+bool Music::nextNote(musicArr &n)
+{
+  if(m_q.pop(n))
+    return true;
+  if(m_pSong == NULL)
+    return false;
+
+  n.note = pgm_read_word(m_pSong + m_songPos * 2);
+  int16_t divider = (int16_t)pgm_read_word(m_pSong + m_songPos * 2 + 1);
+  uint16_t noteDuration = m_wholeNote / abs(divider);
+  if(divider < 0) // dotted notes are represented with negative durations
+    noteDuration += noteDuration / 2;
+  n.ms = noteDuration * 9 / 10; // we only play the note for 90% of the duration, leaving 10% as a pause
+
+  if(++m_songPos >= m_songNotes)
+    m_pSong = NULL;
+  return true;
+}
@@ -8,6 +8,8 @@
 #endif
 
 #include <Arduino.h>
+#include <Ticker.h>
+#include "spscRing.h"
 
 //  More songs and code available at https://github.com/robsoncouto/arduino-songs
 //                                             Robson Couto, 2019
@@ -108,6 +110,16 @@ struct musicArr{
   uint16_t ms;
 };
 
+#define MUS_LEN   32 // queued notes. Songs are read from flash as they play
+#define MUS_TICK  2  // ms between timer calls, the note timing resolution
+#define MUS_DECAY 5  // ticks per envelope step
+#ifndef ESP32
+#define MUS_MIN_FREQ 100 // analogWriteFreq() lower limit
+#endif
+
+// Notes are timed and the volume envelope stepped by a Ticker, so the rhythm doesn't depend on
+// loop().  The PWM makes the tone.  On ESP8266 timer1 drives the PWM, so the Ticker is an os_timer
+// there.  add() and play() only queue, the timer does the rest
 class Music
 {
 public:
@@ -115,17 +127,27 @@ public:
   {
   }
   void init(void);
-  bool add(uint16_t note, uint16_t delay);
-  void service(void);
+  bool add(uint16_t note, uint16_t delay, bool bNow = false); // bNow cuts off what's playing
   bool play(int song);
+  bool playing(void);
 protected:
-  void playNote(int note, int duration);
-#define MUS_LEN 99
-  musicArr m_arr[MUS_LEN+1];
-  int16_t m_idx;
-  int8_t m_volume;
-  bool m_bPlaying;
-  uint32_t m_toneEnd;
+  static void tick(Music *pThis);
+  void onTick(void);
+  void playNote(const musicArr &n);
+  bool nextNote(musicArr &n);
+
+  Ticker m_ticker;
+  SpscRing<musicArr, MUS_LEN> m_q;   // go ahead of the rest of a song
+  SpscRing<musicArr, 4> m_nowq;      // cut in
+  std::atomic<uint8_t> m_songReq;    // song+1 to start, 0 = none
+  const int16_t *m_pSong;  // PROGMEM note, divider pairs. NULL = no song
+  uint16_t m_songPos;
+  uint16_t m_songNotes;
+  uint16_t m_wholeNote;    // ms
+  uint16_t m_ticksLeft;    // of the playing note
+  uint8_t  m_env;          // envelope step
+  uint8_t  m_envTick;
+  volatile bool m_bPlaying;
 };
 
 #endif
@@ -0,0 +1,138 @@
+#include "occupancy.h"
+
+static const char *occName[] = {"empty", "room", "bed", "restless"};
+
+const char *Occupancy::name(uint8_t cls)
+{
+  return (cls < OCC_CNT) ? occName[cls] : "";
+}
+
+bool Occupancy::add(const radarSample &r, uint16_t bedGates)
+{
+  occFrame &f = m_win[m_idx];
+
+  if(m_fill == OCC_WIN) // drop the oldest
+  {
+    for(uint8_t g = 0; g < LD_GATES; g++)
+    {
+      m_sumMov[g] -= f.mov[g];
+      m_sumStat[g] -= f.stat[g];
+    }
+    m_cnt[f.label]--;
+  }
+  else
+    m_fill++;
+
+  if(r.gates)
+  {
+    memcpy(f.mov, r.movGate, LD_GATES);
+    memcpy(f.stat, r.statGate, LD_GATES);
+  }
+  else // basic frame, put the target energies in their gates
+  {
+    memset(f.mov, 0, LD_GATES);
+    memset(f.stat, 0, LD_GATES);
+    if(r.bMoving)
+      f.mov[min(r.movDist / LD_GATE_CM, LD_GATES - 1)] = r.movEnergy;
+    if(r.bStationary)
+      f.stat[min(r.statDist / LD_GATE_CM, LD_GATES - 1)] = r.statEnergy;
+  }
+
+  for(uint8_t g = 0; g < LD_GATES; g++)
+  {
+    m_sumMov[g] += f.mov[g];
+    m_sumStat[g] += f.stat[g];
+    if(!r.bPresence) // learn the clutter of the empty room
+    {
+      m_baseMov[g] += f.mov[g] - (m_baseMov[g] >> 4);
+      m_baseStat[g] += f.stat[g] - (m_baseStat[g] >> 4);
+    }
+  }
+
+  f.label = classify(r, bedGates);
+  m_cnt[f.label]++;
+  m_label = f.label;
+  if(!(m_firstSet & (1 << f.label)))
+  {
+    m_firstSet |= 1 << f.label;
+    m_firstMs[f.label] = r.ms;
+  }
+  if(++m_idx == OCC_WIN)
+    m_idx = 0;
+
+  if(f.label != OCC_EMPTY)
+    m_seenMs = r.ms;
+  return decide(r.ms);
+}
+
+uint8_t Occupancy::classify(const radarSample &r, uint16_t bedGates)
+{
+  uint16_t bedAct = 0;
+  uint16_t bedMov = 0;
+  uint16_t roomAct = 0;
+
+  for(uint8_t g = 0; g < LD_GATES; g++)
+  {
+    int16_t mov = m_sumMov[g] / m_fill - (m_baseMov[g] >> 4) - OCC_THR;
+    int16_t stat = m_sumStat[g] / m_fill - (m_baseStat[g] >> 4) - OCC_THR;
+    if(mov < 0) mov = 0;
+    if(stat < 0) stat = 0;
+
+    if(bedGates & (1 << g))
+    {
+      bedAct += mov + stat;
+      bedMov += mov;
+    }
+    else
+      roomAct += mov + stat;
+  }
+
+  if(bedAct == 0 && roomAct == 0) // nothing over the baseline, go by the radar's own detection
+  {
+    if(!r.bPresence)
+      return OCC_EMPTY;
+    return (bedGates & (1 << min(r.detDist / LD_GATE_CM, LD_GATES - 1))) ? OCC_BED : OCC_ROOM;
+  }
+  if(roomAct > bedAct)
+    return OCC_ROOM;
+  if(bedMov >= OCC_MOVING)
+    return OCC_RESTLESS;
+  return OCC_BED;
+}
+
+bool Occupancy::decide(uint32_t ms)
+{
+  uint8_t cand = 0;
+
+  for(uint8_t c = 1; c < OCC_CNT; c++)
+    if(m_cnt[c] > m_cnt[cand])
+      cand = c;
+
+  if(cand != m_cand)
+  {
+    m_cand = cand;
+    m_candMs = ms;
+  }
+
+  if(cand == m_cls || m_fill < OCC_WIN / 2 || m_cnt[cand] * 100 < OCC_SWITCH * m_fill)
+    return false;
+
+  if(inBed() && cand != OCC_BED && cand != OCC_RESTLESS)
+  {
+    if(cand == OCC_EMPTY && ms - m_seenMs < OCC_BED_HOLD)
+      return false;
+    if(cand == OCC_ROOM && ms - m_candMs < OCC_LEAVE)
+      return false;
+  }
+  m_latency = ms - m_firstMs[cand];
+  m_firstSet = 0;
+  m_cls = cand;
+  return true;
+}
+
+uint8_t Occupancy::confidence()
+{
+  if(m_fill == 0)
+    return 0;
+  return m_cnt[m_cls] * 100 / m_fill;
+}
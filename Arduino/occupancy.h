@@ -0,0 +1,70 @@
+#ifndef OCCUPANCY_H
+#define OCCUPANCY_H
+
+#include <Arduino.h>
+#include "ldFrame.h"
+
+#define OCC_WIN       32     // frames in the feature window, ~3s in engineering mode
+#define OCC_THR       10     // mean gate energy over the empty room baseline that counts as activity
+#define OCC_MOVING    20     // moving activity summed over the bed gates
+#define OCC_SWITCH    75     // % of the window a new class needs
+#define OCC_LEAVE     5000   // ms in the room before the bed is left
+#define OCC_BED_HOLD  90000  // ms with nothing seen before the bed is empty
+
+enum occClass
+{
+  OCC_EMPTY,
+  OCC_ROOM,
+  OCC_BED,
+  OCC_RESTLESS,
+  OCC_CNT
+};
+
+struct occFrame
+{
+  uint8_t mov[LD_GATES];
+  uint8_t stat[LD_GATES];
+  uint8_t label;
+};
+
+// Classifies each radar frame from the per gate energies averaged over the last OCC_WIN frames,
+// split by the gates that cover the bed.  The sums are kept running so a frame costs one pass
+// over the gates.  The class only changes once most of the window agrees, and leaving the bed
+// needs OCC_LEAVE of room activity or OCC_BED_HOLD of nothing, so a still sleeper or a
+// dropped detection isn't an out of bed event.
+class Occupancy
+{
+public:
+  Occupancy(){}
+  bool add(const radarSample &r, uint16_t bedGates); // returns true if the class changed
+  uint8_t cls(void){ return m_cls; }
+  uint8_t label(void){ return m_label; } // last frame's own class
+  uint8_t confidence(void);  // % of the window that agrees with the class
+  uint32_t latency(void){ return m_latency; } // ms from the first frame of the new class to the change
+  bool inBed(void){ return m_cls == OCC_BED || m_cls == OCC_RESTLESS; }
+  const char *name(uint8_t cls);
+private:
+  uint8_t classify(const radarSample &r, uint16_t bedGates);
+  bool decide(uint32_t ms);
+
+  occFrame m_win[OCC_WIN];
+  uint16_t m_sumMov[LD_GATES];
+  uint16_t m_sumStat[LD_GATES];
+  uint16_t m_baseMov[LD_GATES];  // empty room energy, x16
+  uint16_t m_baseStat[LD_GATES];
+  uint8_t  m_cnt[OCC_CNT];       // labels in the window
+  uint8_t  m_idx;
+  uint8_t  m_fill;
+  uint8_t  m_cls;
+  uint8_t  m_label;
+  uint8_t  m_cand;
+  uint32_t m_candMs;   // when m_cand took the window
+  uint32_t m_seenMs;   // last frame that wasn't empty
+  uint32_t m_firstMs[OCC_CNT]; // first frame of each label since the last change
+  uint8_t  m_firstSet;
+  uint32_t m_latency;
+};
+
+extern Occupancy occ;
+
+#endif // OCCUPANCY_H
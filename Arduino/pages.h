@@ -1,592 +1,348 @@
-const char index_page[] PROGMEM = R"rawliteral(
-<!DOCTYPE html><html lang="en">
-<head>
-<meta name="viewport" content="width=device-width, initial-scale=1"/>
-<title>WiFi Waterbed Heater</title>
-<style type="text/css">
-table{
-border-radius: 2px;
-margin-bottom: 2px;
-box-shadow: 4px 4px 10px #000000;
-background: rgb(160,160,160);
-background: linear-gradient(0deg, rgba(94,94,94,1) 0%, rgba(160,160,160,1) 90%);
-background-clip: padding-box;
-}
-input{
-border-radius: 2px;
-margin-bottom: 2px;
-box-shadow: 4px 4px 10px #000000;
-background: rgb(160,160,160);
-background: linear-gradient(0deg, rgba(160,160,160,1) 0%, rgba(239,255,255,1) 100%);
-background-clip: padding-box;
-}
-div{
-border-radius: 2px;
-box-shadow: 2px 2px 10px #000000;
-background: rgb(160,160,160);
-background: linear-gradient(0deg, rgba(200,190,200,1) 0%, rgba(140,180,180,1) 100%);
-background-clip: padding-box;
-}
-body{width:300px;display:block;margin-left:auto;margin-right:auto;text-align:right;font-family: Arial, Helvetica, sans-serif;}}
-</style>
-<script src="http://ajax.googleapis.com/ajax/libs/jquery/1.6.1/jquery.min.js" type="text/javascript" charset="utf-8"></script>
-<script type="text/javascript">
-a=document.all
-oledon=0
-avg=1
-cnt=1
-eco=0
-debug=false
-cf='F'
-function openSocket(){
-ws=new WebSocket("ws://"+window.location.host+"/ws")
-//ws=new WebSocket("ws://192.168.31.74/ws")
-ws.onopen=function(evt){}
-ws.onclose=function(evt){alert("Connection closed.");}
-ws.onmessage=function(evt){
- console.log(evt.data)
- d=JSON.parse(evt.data)
- if(d.cmd=='state')
- {
-  dt=new Date(d.t*1000)
-  a.time.innerHTML=dt.toLocaleTimeString()
-  waterTemp=+d.waterTemp
-  a.temp.innerHTML=(d.on?"<font color='red'><b>":"")+waterTemp+"&deg"+cf+(d.on?"</b></font>":"")
-  a.tgt.innerHTML="> "+d.hiTemp+"&deg"+cf
-  a.rt.innerHTML=+d.temp+'&deg'+cf
-  a.rh.innerHTML=+d.rh+'%'
-  eta=+d.eta
-//  if(eta==0) eta=+d.cooleta
-  a.eta.innerHTML='ETA '+t2hms(eta)
- }
- else if(d.cmd=='set')
- {
-  a.vt.value=+d.vt
-  oledon=d.o
-  a.OLED.value=oledon?'ON ':'OFF'
-  avg=d.avg
-  a.AVG.value=avg?'ON ':'OFF'
-  a.tz.value=d.tz
-  ppkw=d.ppkwh/1000
-  a.K.value=ppkw
-  a.vo.value=d.vo?'ON ':'OFF'
-  a.eco.value=d.e?'ON ':'OFF'
-  eco=d.e
-  watts=d.w
-  idx=d.idx
-  schedules=d.item
-  schedCnt=d.cnt
-  setSeason(d.season)
-  draw_bars(d.ts,d.ppkwm)
- }
- else if(d.cmd=='tdata')
- {
-  tdata=d.temp
-  draw()
- }
- else if(d.cmd=='radar')
- {
-   a.pres.innerHTML=' Presnece:'+d.pres
-  a.dist.innerHTML=' Distance:'+d.dist
-  a.energy.innerHTML=' Energy:'+d.energy
- }
- else if(d.cmd=='alert')
- {
-  alert(d.data)
- }
-}
-}
-function onChangeSched(ent)
-{
- id=ent.id.substr(0,1)
- idx=ent.id.substr(1)
- val=ent.value
- if(id=='S')
- {
-  tm=val.split(':')
-  val=(+tm[0]*60)+(+tm[1])
- }
- setVar('I',idx)
- setVar(id,val)
- draw()
-}
-function setSeason(s)
-{
-  seasEdit=s
-  for(i=0;i<4;i++)
-    document.getElementById('s'+i).setAttribute('style',(i==seasEdit)?'background-color:red':'none')
-  itms=schedules[seasEdit]
-  cnt=schedCnt[seasEdit]
-  for(i=0;i<8;i++){
-   item=document.getElementById('r'+i); item.setAttribute('style',i<cnt?'':'display:none')
-   if(i==idx) item.setAttribute('style','background-color:red')
-   h=Math.floor(itms[i][0]/60)
-   m=itms[i][0]%60
-   if(m<10) m='0'+m
-   document.getElementById('S'+i).value=h+':'+m
-   document.getElementById('T'+i).value=itms[i][1]
-   document.getElementById('H'+i).value=itms[i][2]
-   document.getElementById('S'+i).onchange=function(){onChangeSched(this)}
-   document.getElementById('T'+i).onchange=function(){onChangeSched(this)}
-   document.getElementById('H'+i).onchange=function(){onChangeSched(this)}
-  }
-  a.inc.value=Math.min(8,cnt+1)
-  a.dec.value=Math.max(1,cnt-1)
-}
+// Generated by web/mkpages.py from the files in web/, edit those and run it again
 
-function setVar(varName, value)
-{
- ws.send('{"key":"'+a.myKey.value+'","'+varName+'":'+value+'}')
-}
-function oled(){
-setVar('oled',oledon?0:1)
-}
-function setavg(){avg=!avg
-setVar('avg',avg?1:0)
-draw()
-}
-function setTZ(){
-setVar('TZ',a.tz.value)}
-function setTemp(n){
-setVar('tadj',n)
-}
-function setAllTemp(n){
-setVar('aadj',n)
-}
-function setEco(n){
-eco=!eco
-setVar('eco',eco?1:0)
-}
-function setVaca(){
-setVar('vacatemp',a.vt.value)
-setVar('vaca',(a.vo.value=='OFF')?true:false)
-}
-function setCnt(n){
-cnt+=n
-setVar('cnt',cnt)
-}
-function setPPK(){
-setVar('ppkwh',(a.K.value*1000).toFixed())
-}
-
-var x,y,llh=0,llh2=0
-function draw(){
- try{
-  c2=document.getElementById('canva')
-  ctx=c2.getContext("2d")
-  ctx.fillStyle="#88f" // bg
-  ctx.fillRect(0,0,c2.width,c2.height)
-
-  ctx.font = "bold 11px sans-serif"
-  ctx.lineWidth = 1
-  getLoHi()
-  ctx.strokeStyle = "#000"
-  ctx.fillStyle = "#000"
-  if(avg){
-   ctx.beginPath()
-   m=c2.width-tm2x(itms[cnt-1][0])
-   r=m+tm2x(itms[0][0])
-   tt1=tween(+itms[cnt-1][1],+itms[0][1],m,r) // get y of midnight
-   th1=tween(+itms[cnt-1][1]-itms[cnt-1][2],+itms[0][1]-itms[0][2],m,r) // thresh
-   ctx.moveTo(0, t2y(tt1)) //1st point
-   for(i=0;i<cnt;i++){
-     x=tm2x(itms[i][0]) // time to x
-     linePos(+itms[i][1])
-   }
-   i--;
-   x = c2.width
-   linePos(tt1) // temp at mid
-   linePos(th1) // thresh tween
-   for(;i>=0;i--){
-    x=tm2x(itms[i][0])
-    linePos(itms[i][1]-itms[i][2])
-   }
-   x=0
-   linePos(th1) // thresh at midnight
-   ctx.closePath()
-   if(a.vo.value=='ON ')
-     ctx.fillStyle = "rgba(130,130,130,0.3)" // thresholds (not active)
-   else
-     ctx.fillStyle = "rgba(80,80,80,0.5)" // thresholds
-   ctx.fill()
-   ctx.fillStyle = "#000" // temps
-   for(i=0;i<cnt;i++){
-    x=tm2x(itms[i][0]) // time to x
-    ctx.fillText(itms[i][1],x,t2y(+itms[i][1])-4)
-   }
-  }else{
-   for(i=0;i<cnt;i++)
-   {
-    x=tm2x(itms[i][0])
-    y=t2y(itms[i][1]) // temp
-    y2=t2y(itms[i][1]-itms[i][2])-y // thresh
-    if(i==cnt-1) x2=c2.width-x
-    else x2=tm2x(itms[i+1][0])-x
-    if(a.vo.value=='ON ')
-      ctx.fillStyle = "rgba(130,130,130,0.3)" // thresh
-    else
-      ctx.fillStyle = "rgba(80,80,80,0.5)" // thresh
-    ctx.fillRect(x, y, x2, y2)
-    ctx.fillStyle = "#000" // temp
-    ctx.fillText(itms[i][1], x, y-2)
-   }
-   x0=tm2x(itms[0][0])
-   ctx.fillStyle = "#666"
-   ctx.fillRect(0, y, x0, y2) // rollover midnight
-  }
-
-  if(a.vo.value=='ON ')
-  {
-   ctx.fillStyle = "rgba(90,90,90,0.5)" // vacation thresh
-   y=t2y(+a.vt.value)
-   y2=t2y(+a.vt.value-1)
-   ctx.fillRect(0, y, c2.width, y2)
-  }
-
-  ctx.fillStyle = "#000" // temps
-  step=c2.width/cnt
-  y=c2.height
-  ctx.fillText(12,c2.width/2-6, y)//hrs
-  ctx.fillText(6, c2.width/4-3, y)
-  ctx.fillText(18,c2.width/2+c2.width/4-6, y)
-  getLoHi()
-  ctx.fillStyle = "#337" // temp scale
-  ctx.fillText(hi,0,10)
-  ctx.fillText(lo,0,c2.height)
-  hl=hi-lo
-  ctx.strokeStyle = "rgba(13,13,13,0.1)" // h-lines
-  step=c2.height/hl
-  ctx.beginPath()
-  for(y=step,n=hi-1;y<c2.height;y+= step){  // vertical lines
-    ctx.moveTo(14,y)
-    ctx.lineTo(c2.width,y)
-    ctx.fillText(n--,0,y+3)
-  }
-  ctx.stroke()
-  step = c2.width/24
-  ctx.beginPath()
-  for(x=step;x<c2.width;x+=step){ // vertical lines
-    ctx.moveTo(x,0)
-    ctx.lineTo(x,c2.height)
-  }
-  ctx.stroke()
-  ctx.beginPath()
-  ctx.strokeStyle="#0D0"
-  brk=false
-  for(i=0;i<tdata.length;i++) // rh
-  {
-   if(+tdata[i][1]==0) continue
-   x=tm2x(tdata[i][0])
-   y=c2.height-(tdata[i][4]/100*c2.height)
-   ctx.lineTo(x,y)
-   ctx.stroke()
-   ctx.beginPath()
-   if(tdata[i][2]!=2)
-     ctx.moveTo(x,y)
-  }
-
-  ctx.beginPath()
-  ctx.strokeStyle="#834"
-  for(i=0;i<tdata.length;i++) // room temp
-  {
-   if(+tdata[i][1]==0) continue
-   x=tm2x(tdata[i][0])
-   y=t2y(+tdata[i][3])
-   ctx.lineTo(x,y)
-   ctx.stroke()
-   ctx.beginPath()
-   if(tdata[i][2]!=2)
-     ctx.moveTo(x,y)
-  }
-
-  ctx.beginPath()
-  for(i=0;i<tdata.length;i++) // WB temp
-  {
-   if(+tdata[i][1]==0) continue;
-   x=tm2x(tdata[i][0])
-   y=t2y(+tdata[i][1])
-   ctx.lineTo(x,y)
-   ctx.stroke()
-   ctx.beginPath()
-   switch(+tdata[i][2])
-   {
-     case 0: ctx.strokeStyle="#00F"; ctx.moveTo(x,y); break //off
-     case 1: ctx.strokeStyle="#F00"; ctx.moveTo(x,y); break //on
-     case 2: break
-   }
-  }
-  dt=new Date()
-  x=tm2x((dt.getHours()*60)+dt.getMinutes())
-  ctx.beginPath()
-  y=t2y(waterTemp)
-  ctx.moveTo(x,y)
-  ctx.lineTo(x-4,y+6)
-  ctx.lineTo(x+4,y+6)
-  ctx.closePath()
-  ctx.fillStyle="#0f0" // arrow
-  ctx.fill()
-  ctx.stroke()
-}catch(err){}
-}
-function linePos(t)
-{
-  ctx.lineTo(x,t2y(t))
-}
-function tm2x(t)
-{
-  return t*c2.width/1440
-}
-function t2y(t)
-{
-  return c2.height-((t-lo)/(hi-lo)*c2.height)
-}
-function tween(t1, t2, m, r)
-{
-  t=(t2-t1)*(m*100/r)/100
-  t+=t1
-  return t.toFixed(1)
-}
-function getLoHi()
-{
-  lo=99
-  hi=60
-  for(i=0;i<cnt;i++){
-  if(itms[i][1]>hi) hi=itms[i][1]
-  if(itms[i][1]-itms[i][2]<lo) lo=itms[i][1]-itms[i][2]
-  }
-  for(i=0;i<tdata.length;i++)
-  {
-  if(+tdata[i][1]>hi) hi=+tdata[i][1]
-  if(+tdata[i][3]>hi) hi=+tdata[i][3]
-  if(+tdata[i][1]>0&&+tdata[i][1]<lo) lo=+tdata[i][1]
-  if(+tdata[i][3]>0&&+tdata[i][3]<lo) lo=+tdata[i][3]
-  }
-  lo=Math.floor(lo)
-  hi=Math.ceil(hi)
-}
-function draw_bars(ar,pp)
-{
-  graph = $('#graph')
-  var c=document.getElementById('graph')
-  rect=c.getBoundingClientRect()
-  canvasX=rect.x
-  canvasY=rect.y
-
-  tipCanvas=document.getElementById("tip")
-  tipCtx=tipCanvas.getContext("2d")
-  tipDiv=document.getElementById("popup")
-
-  ctx=c.getContext("2d")
-  ctx.fillStyle="#FFF"
-  ctx.font="10px sans-serif"
-  ctx.lineCap="round"
-
-  dots=[]
-  date=new Date()
-  ht=c.height
-  ctx.lineWidth=10
-  draw_scale(ar,pp,c.width-4,ht-2,2,1,date.getMonth())
-
-  // request mousemove events
-  graph.mousemove(function(e){handleMouseMove(e);})
-
-  // show tooltip when mouse hovers over dot
-  function handleMouseMove(e){
-    rect=c.getBoundingClientRect()
-    mouseX=e.clientX-rect.x
-    mouseY=e.clientY-rect.y
-    var hit = false
-    for(i=0;i<dots.length;i++){
-      dot=dots[i]
-      if(mouseX>=dot.x && mouseX<=dot.x2 && mouseY>=dot.y && mouseY<=dot.y2){
-        tipCtx.clearRect(0,0,tipCanvas.width,tipCanvas.height)
-        tipCtx.fillStyle="#000000"
-        tipCtx.strokeStyle='#333'
-        tipCtx.font='italic 8pt sans-serif'
-        tipCtx.textAlign="left"
-        tipCtx.fillText(dot.tip, 4,15)
-        tipCtx.fillText(dot.tip2,4,29)
-        tipCtx.fillText(dot.tip3,4,44)
-        popup=document.getElementById("popup")
-        popup.style.top =(dot.y)+"px"
-        x=dot.x-60
-        if(x<10)x=10
-        popup.style.left=x+"px"
-        hit=true
-      }
-    }
-    if(!hit){popup.style.left="-1000px"}
-  }
-
-  function getMousePos(cDom, mEv){
-    rect = cDom.getBoundingClientRect();
-    return{
-     x: mEv.clientX-rect.left,
-     y: mEv.clientY-rect.top
-    }
-  }
-}
-
-function draw_scale(ar,pp,w,h,o,p,ct)
-{
-  ctx.fillStyle="#336"
-  ctx.fillRect(2,o,w,h-3)
-  ctx.fillStyle="#FFF"
-  max=0
-  tot=0
-  costTot=0
-  for(i=0;i<ar.length;i++)
-  {
-    if(ar[i]>max) max=ar[i]
-    tot+=ar[i]
-  }
-  ctx.textAlign="center"
-  lw=ctx.lineWidth
-  clr='#55F'
-  mbh=0
-  bh=0
-  for(i=0;i<ar.length;i++)
-  {
-    x=i*(w/ar.length)+4+ctx.lineWidth
-    ctx.strokeStyle='#55F'
-    if(ar[i]){
-        bh=ar[i]*(h-28)/max
-        y=(o+h-20)-bh
-      ctx.beginPath()
-        ctx.moveTo(x,o+h-22)
-        ctx.lineTo(x,y)
-      ctx.stroke()
-    }
-    ctx.strokeStyle="#FFF"
-    ctx.fillText(i+p,x,o+h-7)
-
-    if(i==ct)
-    {
-      ctx.strokeStyle="#000"
-      ctx.lineWidth=1
-      ctx.beginPath()
-        ctx.moveTo(x+lw+1,o+h-2)
-        ctx.lineTo(x+lw+1,o+1)
-      ctx.stroke()
-      ctx.lineWidth=lw
-    }
-    bh=+bh.toFixed()+5
-    x=+x.toFixed()
-    cost=+(ppkw*ar[i]*(watts/3600000)).toFixed(2)
-    costTot+=cost
-    if(ar[i])
-      dots.push({
-      x: x-lw/2,
-      y: (o+h-20)-bh,
-      y2: (o+h),
-      x2: x+lw/2,
-      tip: t2hms(ar[i]),
-      tip2: '$'+cost,
-      tip3: '@ $'+ppkw
-    })
-  }
-  ctx.fillText((tot*watts/3600000).toFixed(1)+' KWh',w/2,o+10)
-  ctx.fillText('$'+costTot.toFixed(2),w/2,o+22)
-}
-function t2hms(t)
-{
-  s=t%60
-  t=Math.floor(t/60)
-  if(t==0) return s
-  if(s<10) s='0'+s
-  m=t%60
-  t=Math.floor(t/60)
-  if(t==0) return m+':'+s
-  if(m<10) m='0'+m
-  h=t%24
-  t=Math.floor(t/24)
-  if(t==0) return h+':'+m+':'+s
-  return t+'d '+h+':'+m+':'+s
-}
-</script>
-<style type="text/css">
-#wrapper {
-  width: 100%;
-  height: 100px;
-  position: relative;
-}
-#graph {
-  width: 100%;
-  height: 100%;
-  position: relative;
-}
-#popup {
-  position: absolute;
-  top: -100px;
-  left: -1000px;
-  z-index: 10;
-}
-</style>
-</head>
-<body bgcolor="silver" onload="{
-key=localStorage.getItem('key')
-if(key!=null) document.getElementById('myKey').value=key
-openSocket()
-}">
-<h3 align="center">WiFi Waterbed Heater</h3>
-<table align=right>
-<tr><td align=center id="time"></td><td align=center><div id="temp"></div> </td><td align=center><div id="tgt"></div></td></tr>
-<tr><td align=center>Bedroom: </td><td align=center><div id="rt"></div></td><td align=center><div id="rh"></div> </td></tr>
-<tr><td id="eta"></td><td>TZ <input id='tz' type=text size=2 value='-5' onchange="{setTZ()}"></td>
-<td>Display:<input type="button" value="ON " id="OLED" onClick="{oled()}"></td></tr>
-<tr><td colspan=2>Vacation <input id='vt' type=text size=2 value='-10'><input type='button' id='vo' onclick="{setVaca()}"> &nbsp &nbsp </td>
-<td>Avg: <input type="button" value="OFF" id="AVG" onClick="{setavg()}"></td></tr>
-<tr><td colspan=2></td>
-<td>Eco: <input type="button" value="OFF" id="eco" onClick="{setEco()}"></td></tr>
-<tr><td>Schedule <input id='inc' type='button' onclick="{setCnt(1)}">Count <input id='dec' type='button' onclick="{setCnt(-1)}"}></td>
-<td> Temperature<br>Adjust</td>
-<td><input type='button' value='Up' onclick="{setTemp(1)}"> <input type='button' value='All Up' onclick="{setAllTemp(1)}"><br><input type='button' value='Dn' onclick="{setTemp(-1)}"> <input type='button' value='All Dn' onclick="{setAllTemp(-1)}"></td></tr>
-<tr>
-<td align="left"></td><td>Time &nbsp;&nbsp;</td><td>Temp &nbsp;Thresh</td>
-<tr><td id="s0"><input type="button" style="width:80px" value="Spring" onClick="{setSeason(0)}"></td><td colspan=2 id='r0' style="display:none"><input id=S0 type=text size=3> <input id=T0 type=text size=3> <input id=H0 type=text size=2></td></tr>
-<tr><td id="s1"><input type="button" style="width:80px" value="Summer" onClick="{setSeason(1)}"></td><td colspan=2 id='r1' style="display:none"><input id=S1 type=text size=3> <input id=T1 type=text size=3> <input id=H1 type=text size=2></td></tr>
-<tr><td id="s2"><input type="button" style="width:80px" value="Fall" onClick="{setSeason(2)}"></td><td colspan=2 id='r2' style="display:none"><input id=S2 type=text size=3> <input id=T2 type=text size=3> <input id=H2 type=text size=2></td></tr>
-<tr><td id="s3"><input type="button" style="width:80px" value="Winter" onClick="{setSeason(3)}"></td><td colspan=2 id='r3' style="display:none"><input id=S3 type=text size=3> <input id=T3 type=text size=3> <input id=H3 type=text size=2></td></tr>
-<tr><td></td><td colspan=2 id='r4' style="display:none"><input id=S4 type=text size=3> <input id=T4 type=text size=3> <input id=H4 type=text size=2></td></tr>
-<tr><td></td><td colspan=2 id='r5' style="display:none"><input id=S5 type=text size=3> <input id=T5 type=text size=3> <input id=H5 type=text size=2></td></tr>
-<tr><td></td><td colspan=2 id='r6' style="display:none"><input id=S6 type=text size=3> <input id=T6 type=text size=3> <input id=H6 type=text size=2></td></tr>
-<tr><td></td><td colspan=2 id='r7' style="display:none"><input id=S7 type=text size=3> <input id=T7 type=text size=3> <input id=H7 type=text size=2></td></tr>
-<tr><td colspan=3><canvas id="canva" width="300" height="140" style="border:1px dotted;float:center" onclick="draw()"></canvas></td></tr>
-<tr><td colspan=3>
-<div id="wrapper">
-<canvas id="graph" width="300" height="100"></canvas>
-<div id="popup"><canvas id="tip" width="70" height="48"></canvas></div>
-</div>
-</td></tr>
-<tr><td colspan=2 align="left">PPKWH $<input id='K' type=text size=2 value='0.1457' onchange="{setPPK()}">
- </td><td> <input id="myKey" name="key" type=text size=40 placeholder="password" style="width: 100px" onChange="{localStorage.setItem('key', key = document.all.myKey.value)}"></td></tr>
-
-<tr><td id="pres"></td><td id="dist"></td><td id="energy"></td></tr>
-</table>
-</body>
-</html>
-)rawliteral";
+// index.htm 15639 bytes, 14239 minified, 5047 gzipped
+#define INDEX_PAGE_ETAG "\"8d5ffced\""
+const uint8_t index_page[] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xCD, 0x3B, 0x6B, 0x77, 0xDB, 0xC6,
+  0x8E, 0xDF, 0xF9, 0x2B, 0x26, 0xEC, 0xAD, 0x49, 0x9A, 0xA4, 0x44, 0x52, 0x8A, 0x93, 0x48, 0xA2,
+  0xB2, 0x69, 0x1C, 0xDF, 0xF4, 0xA6, 0x6D, 0x72, 0xD6, 0xDE, 0xA6, 0x6D, 0xD6, 0x67, 0x0F, 0x45,
+  0x8E, 0x45, 0x36, 0x7C, 0x68, 0xC9, 0x91, 0x25, 0xD5, 0xF5, 0x7F, 0xBF, 0xC0, 0x0C, 0xDF, 0x92,
+  0x6C, 0xDF, 0x9E, 0x7B, 0xF6, 0x6C, 0x62, 0x4B, 0x24, 0x06, 0xC0, 0x00, 0x18, 0x0C, 0x80, 0x79,
+  0x78, 0xF6, 0xEC, 0xFC, 0xE3, 0xDB, 0xAB, 0x5F, 0x3F, 0xBD, 0x23, 0x21, 0x4B, 0xE2, 0xF9, 0x0C,
+  0x3F, 0x49, 0xEC, 0xA5, 0x4B, 0x57, 0xA6, 0xA9, 0x3C, 0x97, 0x66, 0x21, 0xF5, 0x02, 0xF8, 0x4A,
+  0x28, 0xF3, 0x48, 0xEA, 0x25, 0xD4, 0x95, 0x6F, 0x23, 0xBA, 0x59, 0x65, 0x39, 0x93, 0x89, 0x9F,
+  0xA5, 0x8C, 0xA6, 0xCC, 0x95, 0x37, 0x51, 0xC0, 0x42, 0x37, 0xA0, 0xB7, 0x91, 0x4F, 0x4D, 0xFE,
+  0x62, 0x90, 0x28, 0x8D, 0x58, 0xE4, 0xC5, 0x66, 0xE1, 0x7B, 0x31, 0x75, 0x6D, 0x79, 0x08, 0x5C,
+  0x58, 0xC4, 0x62, 0x3A, 0xFF, 0x1C, 0x5D, 0x44, 0xE4, 0xB3, 0xC7, 0x68, 0xBE, 0xA0, 0x01, 0x79,
+  0x4F, 0xF1, 0x69, 0x36, 0x14, 0x6D, 0xD2, 0xAC, 0x60, 0xBB, 0x98, 0x12, 0xB6, 0x5B, 0x41, 0x57,
+  0x8C, 0x6E, 0xD9, 0xD0, 0x2F, 0x0A, 0x79, 0xCE, 0xBC, 0x45, 0x4C, 0xEF, 0x16, 0x59, 0x1E, 0xD0,
+  0xDC, 0xCC, 0xBD, 0x20, 0x5A, 0x17, 0x13, 0x67, 0xB5, 0x9D, 0x26, 0x5E, 0xBE, 0x8C, 0x52, 0x73,
+  0x91, 0x31, 0x96, 0x25, 0x1C, 0xB2, 0xC8, 0xB6, 0x66, 0x11, 0x7A, 0x41, 0xB6, 0x99, 0x8C, 0x57,
+  0x5B, 0x82, 0xBF, 0xB6, 0x05, 0x1F, 0xDF, 0x58, 0xFC, 0xDF, 0x74, 0xE1, 0xF9, 0x5F, 0x97, 0x79,
+  0xB6, 0x4E, 0x83, 0x49, 0xBE, 0x5C, 0xA8, 0xF6, 0x99, 0x65, 0x94, 0xBF, 0x5A, 0xBB, 0x2D, 0x8E,
+  0x52, 0xEA, 0xE5, 0xE6, 0x12, 0xFB, 0x02, 0x1D, 0x55, 0x2B, 0xA0, 0x4B, 0x03, 0x08, 0x3C, 0xF5,
+  0xD5, 0xD8, 0x10, 0x3F, 0xB6, 0x46, 0xAC, 0x6F, 0x05, 0xAC, 0xC5, 0x05, 0xC1, 0xAF, 0xAC, 0x6F,
+  0xDB, 0xCC, 0x4C, 0x3F, 0x8E, 0x56, 0x93, 0x95, 0x17, 0x04, 0x51, 0xBA, 0x04, 0x59, 0xB7, 0xD3,
+  0xFB, 0x28, 0x5D, 0xAD, 0xD9, 0xFF, 0x0F, 0x7D, 0x7A, 0xB2, 0x57, 0x2A, 0x39, 0xA3, 0x57, 0x86,
+  0xF3, 0xFC, 0x39, 0xFF, 0x05, 0xB0, 0x6D, 0x3D, 0xAA, 0x53, 0x10, 0xDD, 0x1E, 0xD0, 0xA8, 0x25,
+  0x3F, 0xBC, 0x12, 0xE7, 0xDF, 0x2E, 0xBF, 0x63, 0x01, 0xF6, 0x2B, 0xCB, 0xE0, 0xDF, 0xAD, 0x21,
+  0x19, 0xC3, 0xEB, 0xCB, 0xF2, 0xF7, 0x49, 0xF2, 0x2F, 0xB2, 0x60, 0x77, 0xC7, 0xBD, 0x77, 0x32,
+  0xB2, 0x40, 0xC4, 0x69, 0x10, 0x15, 0xAB, 0xD8, 0xDB, 0x4D, 0x16, 0x71, 0xE6, 0x7F, 0xAD, 0x86,
+  0x26, 0xA6, 0x37, 0x6C, 0xE2, 0xAD, 0x59, 0x56, 0x01, 0xF2, 0x68, 0x19, 0x96, 0x10, 0xF4, 0x57,
+  0xD3, 0x8B, 0xA3, 0x65, 0x3A, 0xE1, 0xD0, 0xE9, 0x0D, 0xCC, 0x10, 0xF3, 0xC6, 0x4B, 0xA2, 0x78,
+  0x37, 0x79, 0x93, 0xC3, 0x74, 0x30, 0xDE, 0xD3, 0xF8, 0x96, 0xB2, 0xC8, 0xF7, 0x8C, 0xC2, 0x4B,
+  0x0B, 0xB3, 0xA0, 0x79, 0x74, 0x33, 0xBD, 0xBF, 0x9F, 0x0D, 0xB9, 0xDF, 0xA3, 0xFF, 0xFB, 0x79,
+  0xB4, 0x62, 0xED, 0x09, 0xF0, 0xBB, 0x77, 0xEB, 0x09, 0x28, 0x4C, 0x48, 0xCF, 0x0D, 0x32, 0x7F,
+  0x9D, 0x80, 0x09, 0x06, 0x5E, 0x1C, 0x4B, 0x59, 0x4C, 0x83, 0x2C, 0x75, 0x2D, 0xC9, 0xBB, 0x5D,
+  0xBA, 0xB6, 0xE4, 0xC3, 0x6C, 0xB4, 0x25, 0xEA, 0x67, 0x00, 0x09, 0xE8, 0x62, 0xBD, 0x74, 0x6F,
+  0xBC, 0xB8, 0xA0, 0x92, 0x7F, 0xE3, 0x2A, 0x17, 0x8A, 0x54, 0xF8, 0x21, 0x0D, 0xD6, 0x31, 0x2D,
+  0xDC, 0x2F, 0x5F, 0xAE, 0x8D, 0xEA, 0xE7, 0x5A, 0xC0, 0xDF, 0x02, 0xED, 0x17, 0xCB, 0xE0, 0xFF,
+  0x01, 0x44, 0xBD, 0xE2, 0x5D, 0x10, 0x31, 0xD7, 0xB4, 0xA5, 0xDF, 0xD3, 0xD8, 0x55, 0x14, 0x32,
+  0x1C, 0x92, 0xD7, 0x8B, 0x2C, 0x63, 0xEE, 0x49, 0x41, 0xFF, 0xD7, 0x25, 0xD9, 0x0D, 0x61, 0x21,
+  0x85, 0x60, 0x51, 0x30, 0x42, 0x6F, 0x41, 0x20, 0x83, 0x78, 0x24, 0x87, 0xBE, 0xD3, 0x94, 0xFA,
+  0x8C, 0x64, 0x69, 0xBC, 0x23, 0x4B, 0xCA, 0x0A, 0xB2, 0x09, 0x3D, 0x46, 0x36, 0x5E, 0x41, 0x92,
+  0xA8, 0x28, 0x68, 0x20, 0xDD, 0xAC, 0x53, 0x9F, 0x45, 0x59, 0x4A, 0xB2, 0x15, 0x4D, 0x2F, 0xC1,
+  0xB4, 0x94, 0xA9, 0xDA, 0x9D, 0xB4, 0x29, 0xDC, 0x94, 0x6E, 0xC8, 0x67, 0xBA, 0x28, 0x61, 0xF2,
+  0xA6, 0x98, 0x0C, 0x87, 0xB2, 0xBE, 0x89, 0x52, 0xF0, 0x9E, 0x01, 0x0C, 0x82, 0x87, 0x64, 0x83,
+  0x30, 0x2B, 0x98, 0x2E, 0x0F, 0x37, 0x85, 0xAC, 0x83, 0x64, 0x1A, 0x10, 0x0E, 0xB2, 0x14, 0x79,
+  0xB9, 0x15, 0x67, 0x95, 0xDE, 0x32, 0xED, 0x0E, 0xE0, 0x05, 0x4D, 0x03, 0x55, 0xB9, 0x93, 0x8B,
+  0xF5, 0x42, 0x9E, 0xC8, 0x05, 0x83, 0x50, 0x63, 0x14, 0x94, 0x19, 0x61, 0x54, 0x30, 0x03, 0x5C,
+  0xC9, 0xCB, 0x0D, 0x88, 0x4E, 0x39, 0x33, 0xB8, 0x02, 0xF2, 0xBD, 0xA2, 0xDD, 0x0B, 0x76, 0x7E,
+  0x9C, 0x15, 0xB4, 0xC7, 0x0F, 0x08, 0xAF, 0xA2, 0x84, 0x66, 0x6B, 0xA6, 0x36, 0x92, 0x1B, 0xE0,
+  0x2A, 0x56, 0x45, 0x95, 0xD0, 0xA2, 0xF0, 0x96, 0x7D, 0x3A, 0x09, 0x4C, 0x52, 0xC0, 0x40, 0x81,
+  0x06, 0x4B, 0x84, 0x0C, 0x02, 0x8F, 0x79, 0x9A, 0x14, 0xB8, 0xFF, 0xB8, 0xFC, 0xF8, 0xD3, 0x60,
+  0xE5, 0xE5, 0x05, 0x6D, 0x81, 0xA3, 0x1B, 0x35, 0x18, 0xF8, 0x49, 0xE0, 0xBA, 0x0A, 0x97, 0x57,
+  0xD1, 0xA4, 0x3B, 0x29, 0x60, 0xDC, 0x36, 0xE7, 0xF0, 0x0E, 0xAD, 0xEC, 0xD4, 0xC6, 0x4E, 0x25,
+  0x6F, 0xC0, 0x40, 0x9E, 0x41, 0x04, 0x06, 0xCF, 0xDF, 0x5F, 0xFD, 0xF8, 0x83, 0x1B, 0xB0, 0x01,
+  0xCB, 0x7E, 0xC8, 0x30, 0xE2, 0xA2, 0xA4, 0x97, 0x2C, 0x07, 0xE7, 0x56, 0xC1, 0x42, 0x18, 0x62,
+  0xAF, 0x68, 0xB2, 0x72, 0xF5, 0x60, 0x50, 0xBF, 0x20, 0x3D, 0x7C, 0xB5, 0xE8, 0x81, 0x77, 0x96,
+  0xBE, 0x96, 0x67, 0xE8, 0xB6, 0x10, 0xDD, 0xE3, 0x2C, 0x77, 0x95, 0x9C, 0x06, 0xCA, 0x7C, 0xB6,
+  0x98, 0x83, 0xFD, 0x64, 0x4D, 0xAF, 0x89, 0x75, 0xF9, 0x04, 0x66, 0xA0, 0xAC, 0xFB, 0x37, 0x7A,
+  0x45, 0x35, 0x5C, 0xCC, 0x67, 0x43, 0x24, 0x15, 0xB8, 0xC8, 0x7E, 0xC9, 0x5A, 0xDC, 0xE5, 0x39,
+  0x91, 0xA1, 0xFF, 0x30, 0xEA, 0xD2, 0x03, 0x5E, 0xDE, 0x46, 0x03, 0x14, 0x14, 0x4B, 0x57, 0x10,
+  0x41, 0x29, 0x11, 0xC2, 0x2E, 0x42, 0x1E, 0xEA, 0xCA, 0xB7, 0x8A, 0x04, 0x49, 0x09, 0xDF, 0xE0,
+  0x0B, 0x70, 0xE0, 0xB3, 0x85, 0xA4, 0xBC, 0xBB, 0x7A, 0x43, 0x14, 0x9D, 0x39, 0x61, 0x52, 0xA8,
+  0x14, 0x0D, 0x7B, 0x2F, 0x51, 0x98, 0x0A, 0xA4, 0x6D, 0x5F, 0xCA, 0xB8, 0x75, 0xBD, 0x01, 0x58,
+  0xFF, 0xD6, 0x8B, 0xD7, 0x14, 0xB9, 0xDD, 0xB2, 0x6A, 0x56, 0x81, 0x5E, 0xD0, 0xF6, 0xF1, 0x87,
+  0x77, 0xE7, 0x65, 0xAB, 0x80, 0xBF, 0x56, 0x3E, 0xFE, 0x44, 0x94, 0x89, 0xF2, 0xF1, 0x02, 0xA6,
+  0x14, 0xCE, 0xBB, 0x60, 0x00, 0x9F, 0x80, 0xF9, 0xE6, 0xE7, 0xBF, 0x97, 0x88, 0xF0, 0xDE, 0xC5,
+  0x1A, 0xB0, 0x3F, 0xCA, 0x26, 0xD0, 0xEE, 0x0F, 0x69, 0xB5, 0xFA, 0xBA, 0x81, 0x27, 0xFC, 0x0A,
+  0x87, 0x38, 0x98, 0x80, 0xF1, 0xA1, 0x44, 0x40, 0x20, 0x8A, 0x94, 0xD5, 0x04, 0xB7, 0x59, 0x8F,
+  0x19, 0x4C, 0xB2, 0xBA, 0x91, 0x76, 0xDA, 0x70, 0xEA, 0x03, 0x0C, 0x47, 0x9C, 0x15, 0xF0, 0xB4,
+  0x91, 0xA2, 0x60, 0x0B, 0xDF, 0xF0, 0xC9, 0xA7, 0x34, 0xD7, 0x4A, 0x3C, 0x34, 0xB3, 0x1E, 0xEC,
+  0x91, 0x32, 0x68, 0x66, 0x97, 0xBC, 0x41, 0xAD, 0xE6, 0xFE, 0xCC, 0x7A, 0x5D, 0x21, 0x4F, 0x2A,
+  0x18, 0xF8, 0x6D, 0xEE, 0x6D, 0xFE, 0x67, 0x01, 0x5E, 0x8B, 0x9E, 0x58, 0x18, 0x42, 0x8B, 0xE4,
+  0xA0, 0x7D, 0xB1, 0x03, 0x6E, 0xE1, 0x88, 0x25, 0x85, 0x5B, 0x47, 0x9F, 0x2F, 0x15, 0xD7, 0x6B,
+  0xDE, 0x30, 0x88, 0x69, 0xBA, 0xC4, 0xFA, 0x81, 0x8B, 0x71, 0x93, 0xE5, 0xEA, 0xAD, 0x97, 0x13,
+  0x08, 0x6A, 0xD3, 0x74, 0x06, 0x92, 0x83, 0x33, 0x94, 0x18, 0xD3, 0x54, 0xD7, 0x35, 0x82, 0x24,
+  0xC8, 0x81, 0x79, 0x39, 0xD3, 0xD3, 0x6B, 0x57, 0xA0, 0x7C, 0x41, 0x66, 0xD8, 0x75, 0xA9, 0xA5,
+  0x5B, 0x0B, 0x4C, 0xF6, 0x15, 0x3B, 0x24, 0x2C, 0xC3, 0xE9, 0xC7, 0x85, 0xE5, 0x4F, 0xAE, 0xF0,
+  0x42, 0xAE, 0xAD, 0x7A, 0x08, 0x9F, 0x47, 0x8F, 0xD2, 0x7D, 0x56, 0x39, 0x2D, 0xDA, 0xBE, 0x07,
+  0x8E, 0x07, 0xBE, 0xE3, 0xFB, 0xBA, 0x78, 0x82, 0xF9, 0x7F, 0xC3, 0xFD, 0xD5, 0x1B, 0x40, 0x4A,
+  0x61, 0x1D, 0xCC, 0x73, 0x00, 0x78, 0xA9, 0x4F, 0x27, 0x88, 0x18, 0x94, 0x2F, 0x38, 0xC4, 0x80,
+  0xB2, 0xDC, 0x75, 0x50, 0xDF, 0x71, 0x10, 0x47, 0x14, 0xAD, 0x07, 0xA4, 0xE2, 0xD1, 0x4C, 0x48,
+  0x85, 0x4F, 0x00, 0x17, 0x51, 0x65, 0x1F, 0xF3, 0xF7, 0x6C, 0x9D, 0xA7, 0x5E, 0xCC, 0x71, 0x79,
+  0x80, 0x17, 0xB1, 0x1D, 0xB9, 0xE3, 0x03, 0x4C, 0x3F, 0x8C, 0xF2, 0xF8, 0x0A, 0xDF, 0x07, 0xE8,
+  0x79, 0xC4, 0x14, 0x83, 0x7B, 0xA3, 0x62, 0x1C, 0x26, 0xC8, 0x05, 0x7E, 0x07, 0x39, 0x85, 0xAC,
+  0xE9, 0x53, 0x75, 0x88, 0x0C, 0xFE, 0x3B, 0xD0, 0x87, 0x86, 0xD2, 0x62, 0x55, 0x46, 0xB8, 0x9C,
+  0x9E, 0x9C, 0xA0, 0x03, 0x61, 0x9A, 0xAB, 0xC4, 0xFE, 0xF3, 0xCF, 0x06, 0x92, 0x66, 0x2C, 0xBA,
+  0x51, 0x4E, 0x4E, 0xC0, 0xFB, 0x35, 0x4D, 0x23, 0x1D, 0x6D, 0x30, 0x13, 0x89, 0x5C, 0x02, 0xB9,
+  0x25, 0x82, 0x6A, 0xD1, 0xDB, 0x78, 0x68, 0x0C, 0xFC, 0xDF, 0x24, 0x97, 0xF4, 0x6D, 0x08, 0x75,
+  0x2C, 0xBD, 0x44, 0xAF, 0x53, 0x41, 0x56, 0x2E, 0x6A, 0xE0, 0x62, 0xE6, 0x8C, 0x40, 0x92, 0xF5,
+  0xA2, 0x60, 0xB9, 0x8A, 0xB5, 0x81, 0x94, 0xF6, 0x80, 0x00, 0x82, 0xD9, 0xC5, 0x81, 0x7C, 0x96,
+  0xA1, 0xC4, 0x11, 0xEA, 0x7C, 0x29, 0xFC, 0x23, 0x71, 0x01, 0x3C, 0x80, 0xDA, 0x20, 0x62, 0x2A,
+  0x4C, 0x3C, 0x81, 0xAD, 0xEA, 0x2C, 0xF9, 0x62, 0x5D, 0x9F, 0x42, 0xDD, 0xA2, 0xF3, 0x67, 0xFB,
+  0xBA, 0x6D, 0x76, 0x4E, 0x7F, 0xAE, 0x68, 0x04, 0x71, 0x0B, 0x27, 0x00, 0x1F, 0x17, 0xA9, 0xAB,
+  0x4A, 0x51, 0x5F, 0xE9, 0x0E, 0xC2, 0xA6, 0xA2, 0x7B, 0x83, 0x64, 0xF7, 0x81, 0xEE, 0x44, 0xCF,
+  0xBA, 0x22, 0x1B, 0x32, 0x78, 0xAD, 0x0C, 0xA3, 0x5E, 0x39, 0xAF, 0xAE, 0x18, 0xF2, 0xF7, 0x08,
+  0x48, 0xF1, 0x49, 0xD1, 0xA3, 0x00, 0xB0, 0xE0, 0x15, 0x08, 0x74, 0x05, 0x32, 0x58, 0xE3, 0xB2,
+  0xB5, 0x2D, 0x5A, 0x33, 0x00, 0x15, 0xA8, 0x73, 0x7B, 0xC1, 0x67, 0x5B, 0x04, 0x33, 0x2D, 0x9A,
+  0x8D, 0xA7, 0x11, 0xCC, 0x2E, 0xA9, 0xAE, 0x2E, 0x20, 0x75, 0xBF, 0x8B, 0x29, 0x3E, 0x7E, 0xB7,
+  0xFB, 0x1E, 0x24, 0x2C, 0xA0, 0x27, 0x6D, 0xC0, 0xAB, 0x94, 0x41, 0x53, 0x46, 0xBD, 0xE5, 0x49,
+  0x02, 0x58, 0x34, 0xF3, 0xED, 0x35, 0x4F, 0x19, 0x13, 0x45, 0xE9, 0xCF, 0xFA, 0x0A, 0xE3, 0x9A,
+  0x97, 0x29, 0x3F, 0x7A, 0x2C, 0x1C, 0x24, 0x11, 0x88, 0x54, 0x86, 0xA1, 0xA6, 0xDD, 0x68, 0x45,
+  0x05, 0xAD, 0x25, 0x22, 0x90, 0x71, 0x21, 0xD1, 0x9E, 0xCF, 0x78, 0x18, 0x88, 0xAE, 0xB5, 0x3B,
+  0x64, 0x16, 0x4D, 0x17, 0x39, 0xF5, 0xBE, 0xDE, 0x4B, 0x21, 0x14, 0x2A, 0x07, 0x28, 0xEE, 0xA4,
+  0xC4, 0x2D, 0x09, 0x60, 0x8C, 0xBE, 0x3D, 0xB3, 0x70, 0x48, 0x93, 0x99, 0x6D, 0x69, 0x24, 0x71,
+  0x15, 0x4B, 0xD1, 0x13, 0x29, 0xD4, 0x5D, 0x65, 0xC6, 0x72, 0x45, 0x57, 0xEB, 0x30, 0x21, 0x94,
+  0xCA, 0xD2, 0x93, 0x13, 0xD0, 0x0F, 0x22, 0x28, 0xA8, 0x46, 0xB8, 0x01, 0x5C, 0xB9, 0x5D, 0x48,
+  0xA2, 0x09, 0x26, 0xA0, 0xB3, 0x8C, 0x4A, 0x6B, 0xBA, 0x32, 0x57, 0x24, 0x1D, 0x58, 0x05, 0xF3,
+  0x19, 0xAF, 0xF2, 0x09, 0x0C, 0xFD, 0x39, 0x18, 0x0F, 0x82, 0x01, 0xF7, 0x6D, 0xAC, 0xE9, 0x48,
+  0x11, 0xFD, 0x41, 0xDD, 0x31, 0x11, 0x41, 0x1C, 0x06, 0x31, 0x70, 0x0A, 0xB5, 0x12, 0x70, 0x74,
+  0x0D, 0x4C, 0x64, 0x70, 0x60, 0x9F, 0x3B, 0xB0, 0x2B, 0x77, 0x5D, 0x99, 0x41, 0xF1, 0xA2, 0xC9,
+  0x90, 0x6A, 0xA1, 0x87, 0xFD, 0x9E, 0x2E, 0x0F, 0xF6, 0x34, 0x6A, 0x7A, 0xE2, 0x76, 0xBF, 0x89,
+  0x33, 0xB4, 0x51, 0x6D, 0x91, 0x21, 0x7A, 0x2D, 0x88, 0xAF, 0x27, 0x7F, 0xBD, 0xE7, 0xAB, 0xC7,
+  0x7A, 0xAE, 0xBA, 0xB3, 0xAF, 0x9F, 0xD0, 0x09, 0x69, 0x18, 0xBF, 0x3F, 0xC8, 0xD8, 0xD9, 0x67,
+  0xEC, 0x5C, 0x3F, 0x55, 0x7A, 0xF8, 0xC8, 0x41, 0x85, 0xFB, 0x07, 0xDC, 0xDD, 0x0F, 0x15, 0xAD,
+  0x15, 0x7E, 0x43, 0x09, 0xAB, 0x0B, 0xBF, 0x4C, 0xBB, 0xB5, 0xF3, 0x8E, 0x5F, 0x1A, 0xFB, 0xFE,
+  0xAB, 0xDB, 0x58, 0xFC, 0x04, 0xB4, 0x8B, 0xED, 0x6D, 0x55, 0xFB, 0x00, 0xB2, 0x69, 0x77, 0xA6,
+  0x2A, 0x3A, 0x42, 0xC2, 0x23, 0x5C, 0xE0, 0xED, 0xC8, 0x22, 0x82, 0xFA, 0x99, 0x65, 0x44, 0xB1,
+  0x47, 0xCF, 0x15, 0xA2, 0x5A, 0xEE, 0xE5, 0x3A, 0xD5, 0x0C, 0xA2, 0x9C, 0x2A, 0xAE, 0x97, 0xEE,
+  0x44, 0xEC, 0x7D, 0x06, 0xE8, 0x39, 0x65, 0x10, 0xCD, 0x11, 0x2E, 0x61, 0xEE, 0x2C, 0xAA, 0x59,
+  0x80, 0x2F, 0x0B, 0x98, 0x09, 0x8B, 0xD9, 0x8B, 0xE9, 0xA2, 0x9C, 0x39, 0xC9, 0x89, 0x6A, 0xCF,
+  0x66, 0x0B, 0x08, 0xAA, 0x85, 0xEE, 0x2E, 0xA4, 0x92, 0xB4, 0xE8, 0xC4, 0x0B, 0x88, 0x4F, 0x3C,
+  0x52, 0x20, 0x7D, 0x02, 0x6B, 0x89, 0x2E, 0xAF, 0x6A, 0x6E, 0xD6, 0x2C, 0x8B, 0x2F, 0x8B, 0xEB,
+  0x39, 0xCE, 0xA3, 0x93, 0x13, 0x7C, 0x9C, 0xB9, 0xCA, 0x19, 0x44, 0xBA, 0xE4, 0x4F, 0x17, 0x3A,
+  0x42, 0x40, 0xD5, 0x49, 0xD2, 0x0B, 0x4A, 0x3F, 0x7B, 0x9C, 0xED, 0x4F, 0x5E, 0x42, 0x0D, 0x31,
+  0x9C, 0xD8, 0xE9, 0x93, 0x82, 0x22, 0xC6, 0x3B, 0x4E, 0x58, 0x07, 0x3F, 0x6C, 0xC0, 0xF0, 0xD7,
+  0xCE, 0x01, 0x50, 0xAF, 0xE1, 0xD2, 0xA2, 0xEC, 0x4A, 0xC1, 0x77, 0xC5, 0x28, 0xAB, 0x38, 0x6B,
+  0x62, 0xF7, 0x83, 0x24, 0x94, 0x6D, 0x80, 0x8E, 0x25, 0xDD, 0x33, 0xAC, 0xE8, 0x2A, 0x32, 0x78,
+  0x56, 0x0C, 0x2C, 0xE9, 0xEC, 0x89, 0x75, 0x24, 0xBC, 0x5E, 0xFD, 0xD6, 0xEE, 0xE7, 0xEA, 0x37,
+  0xC0, 0xAF, 0x4B, 0x3E, 0xAD, 0x87, 0x0A, 0x65, 0x85, 0x9A, 0xB6, 0xB0, 0x99, 0x17, 0xFC, 0xAE,
+  0x18, 0x69, 0x9F, 0xE5, 0x9B, 0x38, 0xDE, 0x43, 0xF5, 0x0E, 0xA3, 0xBE, 0xF3, 0x33, 0x8E, 0x86,
+  0xD5, 0xDF, 0x33, 0xF8, 0xA8, 0xF1, 0xE1, 0x59, 0x31, 0xE0, 0x43, 0x48, 0xDE, 0x37, 0xBE, 0xEF,
+  0xB5, 0x85, 0xBE, 0x85, 0x77, 0x2C, 0x79, 0x50, 0xF4, 0xAA, 0x1E, 0xD6, 0x3A, 0xAD, 0x8A, 0xA1,
+  0xB6, 0xEA, 0x52, 0x97, 0x57, 0x9C, 0xDA, 0x6B, 0x96, 0xAF, 0xE9, 0x84, 0x2F, 0x33, 0xFB, 0x3D,
+  0x80, 0x9F, 0x73, 0xB1, 0xFE, 0x6A, 0x96, 0x83, 0xE8, 0x8D, 0xA0, 0x03, 0x19, 0x42, 0x4F, 0xB5,
+  0xBD, 0xC1, 0x86, 0x0E, 0x3F, 0x7D, 0xFA, 0xD0, 0xD6, 0x88, 0x97, 0xD7, 0x5C, 0xE8, 0xB2, 0xB6,
+  0x16, 0xEB, 0x26, 0x58, 0x23, 0x5D, 0x44, 0x5B, 0xF4, 0x0C, 0xA4, 0x47, 0xB7, 0xDE, 0x1A, 0x3B,
+  0x23, 0x8E, 0x43, 0xD7, 0xC2, 0x4F, 0x07, 0xFD, 0xBD, 0x9E, 0x8E, 0x7C, 0xB0, 0x21, 0xE7, 0xE7,
+  0x3B, 0x58, 0xC7, 0x39, 0xEE, 0xD1, 0x78, 0xE1, 0x7B, 0xE9, 0x2D, 0x96, 0x8F, 0x3E, 0xDB, 0xBA,
+  0xBE, 0x83, 0xCD, 0x6F, 0x71, 0x77, 0x6C, 0x0B, 0xCB, 0x58, 0x27, 0x90, 0x39, 0x7C, 0x70, 0x13,
+  0xC5, 0xF1, 0xA5, 0xC8, 0x1F, 0xDF, 0xBC, 0x7C, 0x79, 0x23, 0xE3, 0x2C, 0x5F, 0x2C, 0xEB, 0xA6,
+  0xFF, 0x84, 0x65, 0xB3, 0x8A, 0xCB, 0x6F, 0xA0, 0x17, 0x9B, 0x68, 0xF0, 0x10, 0x52, 0xDC, 0x48,
+  0x28, 0xE9, 0x71, 0x59, 0xE6, 0x12, 0x79, 0x91, 0xC5, 0x01, 0xB1, 0xED, 0xD5, 0x96, 0x34, 0x7B,
+  0x08, 0x32, 0xC7, 0xC0, 0x5D, 0x92, 0xCF, 0x48, 0x0A, 0x68, 0xB6, 0x04, 0x42, 0xFC, 0x90, 0xBD,
+  0x8F, 0x54, 0x41, 0x0D, 0x95, 0x4D, 0xF6, 0x95, 0xF2, 0xFE, 0x91, 0x09, 0xEE, 0xBF, 0xC8, 0x5D,
+  0xB1, 0x1A, 0x30, 0xCC, 0x69, 0xF0, 0x77, 0x5C, 0xBA, 0x42, 0xFB, 0x82, 0x2E, 0xA3, 0xF4, 0x13,
+  0xC4, 0x30, 0x60, 0x94, 0xB8, 0x95, 0x70, 0x26, 0x4B, 0x9C, 0xAD, 0x48, 0x21, 0x30, 0x4E, 0xA6,
+  0x8D, 0x69, 0x44, 0x93, 0x72, 0x37, 0xD1, 0x9B, 0x06, 0x4B, 0x00, 0x19, 0xB3, 0x5D, 0xB6, 0xA1,
+  0x34, 0x55, 0xF5, 0x36, 0xBE, 0x7D, 0x6D, 0xE8, 0x15, 0x1A, 0x3C, 0x27, 0x46, 0xCE, 0xE3, 0x1E,
+  0x48, 0x4D, 0x76, 0xB8, 0xBB, 0x90, 0x44, 0x41, 0x8A, 0xCA, 0x4B, 0x2C, 0x3C, 0x42, 0x6F, 0xB6,
+  0x5F, 0x9D, 0x0E, 0x3B, 0xB3, 0x7A, 0x74, 0x1A, 0xCE, 0x2C, 0x84, 0x3A, 0x3D, 0xE4, 0x3A, 0x25,
+  0xD9, 0x2D, 0xBD, 0xCA, 0xC0, 0xDA, 0x84, 0x39, 0x3B, 0x15, 0x04, 0xD4, 0x10, 0xC3, 0x2E, 0x18,
+  0x59, 0x65, 0x51, 0xB9, 0x0A, 0xE9, 0x97, 0x10, 0x5B, 0xB7, 0xD1, 0x8C, 0x67, 0x4D, 0xC1, 0x14,
+  0x16, 0xDA, 0x18, 0xA2, 0xB7, 0x12, 0x1A, 0xFF, 0x53, 0x56, 0xA8, 0xAD, 0x44, 0x87, 0x0E, 0x16,
+  0x99, 0xE6, 0x54, 0xDA, 0x82, 0x6D, 0x2B, 0xCB, 0xD5, 0x88, 0xD8, 0x2D, 0x67, 0x01, 0xB3, 0x8E,
+  0x78, 0x0C, 0x15, 0x6E, 0xDA, 0x42, 0xBB, 0x25, 0x33, 0xE1, 0xEA, 0x73, 0xA9, 0xA6, 0xD1, 0x1C,
+  0xE5, 0x32, 0xCD, 0x83, 0x12, 0xD5, 0xF4, 0x8D, 0x0C, 0x66, 0x93, 0x1E, 0x51, 0x9C, 0x2D, 0xB8,
+  0xF7, 0x91, 0x4E, 0x84, 0x08, 0xC2, 0xE6, 0x68, 0x24, 0xBE, 0x09, 0x52, 0x0E, 0x3C, 0x7A, 0x44,
+  0x67, 0xEE, 0xC3, 0x9A, 0x53, 0xDB, 0x77, 0x1F, 0xB1, 0xF5, 0x36, 0x82, 0xB2, 0xBA, 0xFC, 0xB5,
+  0x06, 0x23, 0x4D, 0x6E, 0xFA, 0x00, 0xCF, 0x2D, 0x88, 0x0A, 0xC5, 0x3D, 0xF1, 0x60, 0x82, 0xDD,
+  0x42, 0xC8, 0xA0, 0x7C, 0x7F, 0xEA, 0x20, 0x9F, 0x97, 0x96, 0x21, 0x7E, 0xAC, 0xC1, 0xF3, 0x3E,
+  0x93, 0x9A, 0x44, 0xD5, 0x8E, 0x38, 0x71, 0x65, 0xD9, 0xE2, 0x2F, 0x0D, 0x66, 0xC5, 0xF3, 0x0A,
+  0xA7, 0x70, 0x63, 0x4C, 0x63, 0x6B, 0xA0, 0xC3, 0xB4, 0x87, 0xD8, 0x1C, 0xA3, 0x59, 0xEF, 0x51,
+  0x8F, 0xBB, 0x03, 0x5D, 0x49, 0x07, 0x87, 0x69, 0xE7, 0x22, 0x9B, 0x16, 0x97, 0x4A, 0x5A, 0x69,
+  0xE7, 0xF4, 0x9A, 0xDA, 0xE3, 0x67, 0xEE, 0x5A, 0x7E, 0x8C, 0xAB, 0x0A, 0xD7, 0xE5, 0xDE, 0xAF,
+  0x91, 0xAD, 0xD3, 0xCC, 0xCC, 0xAD, 0x58, 0x75, 0x00, 0xA8, 0xD5, 0xAF, 0x2E, 0x66, 0x28, 0x34,
+  0xFE, 0x9B, 0x86, 0xF2, 0xAF, 0x8C, 0x5C, 0x37, 0xD6, 0x6D, 0x0D, 0xB2, 0x33, 0x40, 0x4C, 0xF8,
+  0x72, 0x1E, 0x1B, 0xC5, 0xA3, 0x03, 0x42, 0x90, 0x8B, 0xE9, 0x70, 0xD7, 0xB6, 0xDC, 0xBD, 0xD8,
+  0xB3, 0xCF, 0xF5, 0xEC, 0xEC, 0x4C, 0xEE, 0xC7, 0x5C, 0x2E, 0x87, 0xC5, 0xE5, 0xC0, 0x0E, 0xF3,
+  0x2C, 0x8E, 0x21, 0x40, 0xE4, 0xCD, 0x74, 0xB8, 0x3F, 0x62, 0xB5, 0xBB, 0x23, 0x06, 0x78, 0x65,
+  0x19, 0xE2, 0xA7, 0x36, 0x00, 0x4F, 0xAF, 0x98, 0x52, 0x4A, 0x4B, 0x08, 0x0F, 0xD0, 0xDB, 0xB9,
+  0xB6, 0x1C, 0xFA, 0x16, 0x0C, 0x8B, 0xC3, 0x03, 0xA2, 0xD6, 0x09, 0x82, 0x1B, 0xEE, 0xFE, 0xD1,
+  0x09, 0x50, 0x30, 0xBA, 0xAA, 0xDD, 0x63, 0x88, 0xBB, 0x2C, 0x3B, 0xB7, 0xCE, 0x2D, 0x5D, 0xCB,
+  0xDA, 0x4E, 0x9D, 0x7E, 0x86, 0x8E, 0x79, 0x06, 0x3D, 0x68, 0xC3, 0x61, 0x98, 0x17, 0x5D, 0xAC,
+  0xB3, 0x46, 0x86, 0xE1, 0xD8, 0x1C, 0x21, 0x56, 0x8F, 0xCD, 0xCB, 0x16, 0x1B, 0xBD, 0x85, 0xCB,
+  0x39, 0xF6, 0x32, 0x53, 0x57, 0xF4, 0xD1, 0xE8, 0x45, 0x2D, 0x3A, 0xE1, 0xA7, 0x47, 0x5D, 0xD6,
+  0x61, 0x04, 0x29, 0x12, 0x56, 0x6E, 0x5D, 0x68, 0x9C, 0x89, 0xC4, 0x59, 0xE5, 0xCB, 0x30, 0x76,
+  0xC3, 0xC8, 0x8C, 0xB3, 0x43, 0xA9, 0xAF, 0xF4, 0x6C, 0x43, 0xFC, 0x58, 0x03, 0x5B, 0x8C, 0x50,
+  0x68, 0x62, 0x5C, 0x6C, 0xAC, 0x25, 0x58, 0x0D, 0xC3, 0x78, 0x2F, 0x0B, 0xE2, 0x2C, 0xDF, 0xB9,
+  0x88, 0x67, 0xA4, 0xD8, 0x8D, 0x3D, 0xDD, 0xCD, 0x6A, 0x82, 0xE9, 0x4E, 0x77, 0x09, 0xB6, 0x69,
+  0x77, 0x84, 0x0F, 0x3C, 0xCD, 0x71, 0xBF, 0x3F, 0x26, 0x82, 0x7B, 0x2B, 0xFB, 0xD8, 0x63, 0xA3,
+  0xB4, 0x1B, 0x36, 0x01, 0xA0, 0x1E, 0xD7, 0xBE, 0x39, 0x53, 0xD3, 0x04, 0xF5, 0x76, 0xFA, 0xA8,
+  0x1A, 0x6D, 0xA1, 0x11, 0x88, 0x82, 0x1D, 0xB5, 0x72, 0xCB, 0xD0, 0x19, 0x1F, 0x94, 0x76, 0xCB,
+  0xA5, 0x9D, 0x6E, 0x67, 0x15, 0xE2, 0x74, 0xAB, 0xBB, 0xA5, 0x90, 0x0F, 0xCA, 0xB8, 0x35, 0xAC,
+  0x8E, 0x88, 0xDB, 0xB6, 0x91, 0x7B, 0xB2, 0xF4, 0x3B, 0xEE, 0x99, 0x1E, 0xAA, 0x1E, 0xEB, 0x1C,
+  0x8A, 0x8B, 0x45, 0xFE, 0xB5, 0x3C, 0x96, 0x68, 0xA2, 0x25, 0xDF, 0x73, 0xAB, 0x96, 0x15, 0x7C,
+  0x8D, 0x8F, 0xD3, 0x30, 0x14, 0x2B, 0x1C, 0x9D, 0xB7, 0x8A, 0xF9, 0xEE, 0xBA, 0xB0, 0x66, 0xC7,
+  0x83, 0xC7, 0x28, 0x5D, 0xD3, 0x2A, 0xB2, 0xD6, 0xED, 0x22, 0xB4, 0xD6, 0x12, 0x9A, 0x4D, 0xCB,
+  0xF8, 0x1A, 0xF7, 0x59, 0x4F, 0x7B, 0x15, 0x55, 0xAD, 0xD4, 0x4E, 0x7B, 0x58, 0x15, 0x90, 0xA2,
+  0x66, 0xE5, 0x5C, 0x3F, 0x73, 0xCB, 0x78, 0x55, 0x1B, 0x69, 0x57, 0x19, 0xE3, 0x61, 0xFD, 0x5F,
+  0x8E, 0xC6, 0xF2, 0xA3, 0x5A, 0x67, 0x59, 0x22, 0x42, 0xDE, 0x5F, 0x52, 0x9E, 0x47, 0x90, 0x1A,
+  0x36, 0xBA, 0xFE, 0xBF, 0x50, 0xF4, 0x11, 0x8D, 0x3E, 0x7F, 0xF7, 0x14, 0x7D, 0xA6, 0x4F, 0x52,
+  0xC8, 0xFE, 0x57, 0x15, 0x2A, 0x36, 0x11, 0xF3, 0xC3, 0x16, 0x07, 0x2C, 0x83, 0x20, 0x6C, 0x7B,
+  0x90, 0x21, 0xAD, 0x09, 0x39, 0xE0, 0xA3, 0xD6, 0x85, 0x3C, 0x25, 0x3D, 0xA5, 0xA7, 0x84, 0x6F,
+  0x30, 0x81, 0x36, 0xD9, 0xCD, 0x8D, 0x20, 0xB6, 0x0F, 0x11, 0x5F, 0x40, 0xDC, 0x7D, 0x88, 0x38,
+  0x15, 0xB4, 0xCE, 0x44, 0x80, 0xF8, 0x96, 0x65, 0xFB, 0x70, 0x47, 0xAB, 0x8C, 0xA0, 0x06, 0x7C,
+  0x8D, 0xF1, 0x3E, 0x5B, 0xE7, 0x85, 0xAA, 0xF1, 0x5D, 0x45, 0x01, 0xF9, 0x11, 0x6C, 0xC5, 0x68,
+  0x81, 0x8B, 0x97, 0xBE, 0xAA, 0xC2, 0x56, 0xF5, 0x11, 0xCD, 0xFE, 0xC8, 0xB5, 0x0D, 0x67, 0x42,
+  0xF0, 0xD1, 0xCF, 0xBA, 0x30, 0xBD, 0x05, 0x6B, 0x17, 0x7F, 0xFD, 0xC5, 0x8B, 0x75, 0x23, 0xB2,
+  0x8B, 0x97, 0xE7, 0xD9, 0xA6, 0x5F, 0x89, 0xD5, 0x23, 0x71, 0x0F, 0x09, 0x0F, 0x2C, 0x4F, 0xF3,
+  0x5C, 0xBB, 0xEB, 0x6C, 0xCD, 0xD6, 0xE5, 0x67, 0x95, 0x3F, 0xEB, 0xC1, 0xE4, 0xC5, 0xB8, 0xD6,
+  0x59, 0xD6, 0x09, 0x97, 0x40, 0xCC, 0x72, 0x13, 0x81, 0x9D, 0xD6, 0xC1, 0xCE, 0x1E, 0x8F, 0xAD,
+  0x0E, 0x2E, 0x27, 0x6F, 0x50, 0x5B, 0x81, 0x40, 0x65, 0x90, 0x0C, 0xB4, 0xA1, 0xCA, 0x93, 0x82,
+  0x76, 0xDA, 0x09, 0x62, 0x0D, 0x3D, 0x5F, 0x64, 0x30, 0x1B, 0x57, 0x05, 0x06, 0x49, 0x0C, 0x92,
+  0xF3, 0xFD, 0x5E, 0x57, 0x65, 0x8E, 0x09, 0xB5, 0xFA, 0xA9, 0x9A, 0xE0, 0x0A, 0x72, 0x98, 0x6B,
+  0x18, 0x4B, 0x24, 0xA6, 0xBB, 0xCC, 0xAE, 0xA5, 0xAA, 0x57, 0x95, 0xDD, 0x5D, 0x85, 0x26, 0xD3,
+  0xDD, 0x49, 0x71, 0xE6, 0xBE, 0x7A, 0x25, 0x85, 0x91, 0x7B, 0x66, 0x1D, 0xAC, 0x49, 0xB1, 0xA0,
+  0xAB, 0x0B, 0x9B, 0x79, 0x18, 0x69, 0x04, 0x70, 0x1B, 0x48, 0xB7, 0xBD, 0x55, 0x16, 0xCE, 0x40,
+  0x23, 0x02, 0xCC, 0x0F, 0x36, 0xA2, 0x30, 0xC7, 0xA7, 0xE7, 0xFE, 0x9C, 0xAC, 0xFA, 0x6D, 0xC3,
+  0xBA, 0x38, 0xA3, 0x03, 0x38, 0xA3, 0xEB, 0x3D, 0x3E, 0xD6, 0xC9, 0x49, 0xFB, 0xBD, 0x12, 0xF2,
+  0x41, 0xBE, 0x1D, 0x9A, 0xD1, 0x01, 0x9A, 0x11, 0xEA, 0x03, 0x90, 0xD6, 0x2E, 0x26, 0xE0, 0xA0,
+  0x4D, 0x39, 0xC4, 0xA7, 0x51, 0x0C, 0x43, 0xDC, 0xDD, 0x51, 0xAB, 0xCF, 0xAB, 0xBC, 0xDC, 0x58,
+  0xAD, 0xAA, 0x6D, 0x2D, 0xFF, 0xF8, 0x5A, 0x7E, 0x99, 0x7B, 0xAB, 0x10, 0x8A, 0xBB, 0x1C, 0x2A,
+  0x2E, 0xD7, 0xC7, 0xE6, 0xEF, 0x70, 0xA7, 0x37, 0x4A, 0x97, 0x6F, 0x63, 0xBC, 0x7C, 0xC0, 0x2B,
+  0x31, 0x70, 0x76, 0x5C, 0xF2, 0x17, 0xBF, 0xB8, 0x88, 0x36, 0xD8, 0x96, 0xAF, 0xBF, 0x8A, 0xD7,
+  0x9D, 0xC4, 0xA2, 0xD5, 0x5B, 0x0E, 0x39, 0xDA, 0x8F, 0x0C, 0x28, 0xB2, 0xC6, 0x11, 0x19, 0xCC,
+  0xFA, 0x0A, 0x7F, 0x7F, 0xEF, 0x00, 0x9A, 0xCE, 0xA3, 0xDB, 0xE3, 0x7C, 0x56, 0xD9, 0x6A, 0xBD,
+  0x92, 0xCB, 0xBD, 0x87, 0xC7, 0xB7, 0x1E, 0x2E, 0x2E, 0x2E, 0xE4, 0x7A, 0x3F, 0xC1, 0x95, 0xF9,
+  0x6D, 0x8C, 0x43, 0x1B, 0x09, 0x6F, 0xBD, 0x95, 0x2B, 0xF3, 0x3D, 0x6E, 0x59, 0x0A, 0x32, 0x56,
+  0xB8, 0x5F, 0xAE, 0x25, 0x18, 0x07, 0xDA, 0x8E, 0x56, 0x21, 0x1A, 0xA8, 0x55, 0x47, 0xD6, 0x1B,
+  0x10, 0xAE, 0x6D, 0x89, 0x93, 0x42, 0x5E, 0xC1, 0x09, 0xD3, 0x1B, 0x7E, 0xB9, 0x40, 0x19, 0x1B,
+  0x30, 0x25, 0x1D, 0xC3, 0x31, 0x6C, 0x03, 0x19, 0xF2, 0xB0, 0x06, 0xB2, 0x84, 0x3C, 0xA8, 0xE1,
+  0x39, 0x7A, 0xB6, 0x2E, 0x28, 0x06, 0x2E, 0x37, 0xF4, 0xD2, 0x20, 0xA6, 0x3F, 0xE2, 0xFB, 0x8F,
+  0xF0, 0xDE, 0x8C, 0x6A, 0xAF, 0x41, 0xA5, 0xDA, 0xDD, 0x63, 0xE3, 0xC5, 0xB9, 0xFE, 0xE2, 0x52,
+  0x08, 0x6D, 0x08, 0xFD, 0xC5, 0x2C, 0x07, 0x8E, 0xC3, 0x7F, 0xAD, 0xE1, 0xBF, 0x9A, 0xE5, 0x08,
+  0xA2, 0x97, 0x84, 0x11, 0xEE, 0xB8, 0xF4, 0xAB, 0x15, 0xB4, 0x46, 0x7B, 0x16, 0xDD, 0xA1, 0x7D,
+  0x5C, 0x84, 0x82, 0x8F, 0xF2, 0xA3, 0x05, 0xDE, 0xD5, 0x1C, 0x41, 0x83, 0x2D, 0x39, 0x39, 0x21,
+  0x02, 0x30, 0x13, 0x00, 0xA7, 0x86, 0xFC, 0x2A, 0x50, 0x76, 0x0D, 0x40, 0xA0, 0x40, 0x59, 0x7F,
+  0x57, 0x3A, 0x06, 0x48, 0x45, 0xBD, 0xBC, 0xDE, 0x1B, 0x6A, 0xDC, 0x44, 0x54, 0x8A, 0xCD, 0x7B,
+  0x15, 0xCF, 0x4A, 0xB2, 0x4E, 0xBC, 0xE6, 0xFF, 0xE4, 0xAA, 0xA9, 0x9D, 0xB2, 0x14, 0xA8, 0xB7,
+  0x47, 0x4A, 0x4D, 0x84, 0x1E, 0xA1, 0x44, 0xCC, 0x8B, 0x23, 0x9F, 0xBC, 0x5C, 0xB1, 0x96, 0x5F,
+  0xD4, 0x38, 0xE8, 0x59, 0x6F, 0xF0, 0x8E, 0x8B, 0x2B, 0xE3, 0x5D, 0x18, 0xB9, 0xDD, 0x21, 0x2F,
+  0x56, 0x51, 0x01, 0x80, 0x19, 0x64, 0x6C, 0xD8, 0xCF, 0xB5, 0x63, 0xCD, 0x8E, 0x31, 0x36, 0x9C,
+  0x57, 0x47, 0x9B, 0x47, 0xD0, 0x3C, 0x86, 0x95, 0x35, 0xF7, 0xED, 0xC7, 0x5D, 0x9F, 0x7F, 0x97,
+  0xA7, 0x53, 0x2C, 0x83, 0x8A, 0x98, 0xF3, 0xD9, 0x69, 0xBA, 0xBC, 0xDA, 0xCA, 0x90, 0x53, 0xB9,
+  0xDD, 0x4D, 0x71, 0xEE, 0xB3, 0xC5, 0x73, 0x9F, 0x2D, 0x3A, 0x68, 0x9B, 0x0A, 0x75, 0x71, 0xB7,
+  0x02, 0x1F, 0x46, 0xDD, 0xC5, 0x6D, 0x4D, 0x9E, 0x9E, 0x71, 0x8B, 0x1D, 0x00, 0xDA, 0xDD, 0x1E,
+  0xB6, 0x6C, 0xE2, 0x7E, 0x22, 0x10, 0xDC, 0xF7, 0x22, 0x3E, 0x77, 0x4B, 0xCC, 0x70, 0xFE, 0x79,
+  0x06, 0x59, 0x24, 0x79, 0x77, 0x5B, 0x7A, 0x27, 0x56, 0xEA, 0x00, 0x3A, 0xE6, 0xA2, 0xD3, 0x32,
+  0x9B, 0xDC, 0x49, 0xDB, 0x09, 0x52, 0x75, 0x3D, 0x15, 0xFB, 0x34, 0xA4, 0x5D, 0xBB, 0xA5, 0xF4,
+  0x55, 0xD0, 0xB8, 0x7F, 0xFC, 0xB9, 0x37, 0xF7, 0x36, 0x46, 0x68, 0x64, 0x06, 0xCC, 0x41, 0xB6,
+  0xB7, 0x6A, 0x75, 0x71, 0xD1, 0xD5, 0x5F, 0x14, 0x3B, 0x80, 0x0D, 0x34, 0xE6, 0xE8, 0x48, 0x00,
+  0x49, 0x3C, 0xDC, 0x49, 0x62, 0xE0, 0xF7, 0x96, 0xE4, 0x67, 0x05, 0xBB, 0xE2, 0x4F, 0xCD, 0x1C,
+  0xF1, 0xF2, 0xFD, 0x3C, 0xE3, 0xE5, 0x30, 0x3F, 0xE6, 0x40, 0xA9, 0x11, 0x24, 0xE7, 0xAF, 0xC8,
+  0x42, 0x2F, 0x1F, 0x45, 0x65, 0xD9, 0x72, 0x30, 0x1F, 0x74, 0xA4, 0xB9, 0x2C, 0xC5, 0x1B, 0xB7,
+  0x13, 0x5D, 0x24, 0x3F, 0xCE, 0xC1, 0x75, 0x9F, 0x3F, 0xBF, 0x50, 0xA4, 0x64, 0x11, 0x42, 0xC7,
+  0xFC, 0xE3, 0x81, 0xDE, 0xB7, 0x6E, 0x74, 0xAA, 0x6E, 0x86, 0x35, 0x5C, 0xD3, 0xC7, 0x7A, 0x8F,
+  0xE5, 0xDE, 0xCC, 0xE0, 0xEC, 0x2B, 0xB1, 0x61, 0x04, 0xA1, 0x0F, 0xFE, 0x78, 0xAA, 0x86, 0xA6,
+  0xF3, 0x52, 0x1B, 0x82, 0x0E, 0x50, 0x73, 0xA9, 0x99, 0x0E, 0xAF, 0x96, 0x66, 0x2E, 0xC2, 0x83,
+  0x2B, 0x80, 0xBA, 0x00, 0xE3, 0x78, 0xCE, 0x23, 0xE5, 0xEB, 0xFD, 0x81, 0x55, 0x43, 0x13, 0xB0,
+  0xEB, 0xFD, 0x0F, 0x7D, 0x65, 0x08, 0x86, 0x2F, 0xB4, 0x6A, 0x1F, 0xA8, 0x1E, 0xD7, 0x7E, 0x39,
+  0x6B, 0xC9, 0xFD, 0xD0, 0xFC, 0xA0, 0x9C, 0x7A, 0xBC, 0xD1, 0x6D, 0x21, 0x6C, 0xAF, 0x3A, 0x2C,
+  0x1B, 0xEC, 0x03, 0x15, 0x77, 0xC3, 0x3C, 0xDE, 0x80, 0x0E, 0x60, 0x29, 0x7D, 0x11, 0x36, 0x1B,
+  0xED, 0xFA, 0x73, 0x18, 0x00, 0x7D, 0xDB, 0x00, 0xB8, 0xCB, 0xB8, 0xBA, 0x8A, 0x5B, 0xF4, 0xA7,
+  0xA5, 0x51, 0xF9, 0x9D, 0x95, 0xE1, 0xE8, 0x8C, 0x07, 0x2B, 0xAD, 0xD9, 0xA6, 0x77, 0xB4, 0xCA,
+  0xC1, 0x74, 0x17, 0x1F, 0x9A, 0x21, 0xE1, 0x69, 0x69, 0xB0, 0x5A, 0x17, 0xA1, 0xCA, 0xA7, 0xCC,
+  0xD6, 0x8C, 0x37, 0x43, 0x87, 0xCF, 0x91, 0xD6, 0xA8, 0xC0, 0xBB, 0x23, 0x00, 0x9A, 0x21, 0x6D,
+  0xE1, 0x11, 0x35, 0x41, 0x34, 0x08, 0x33, 0x13, 0x22, 0x6E, 0x08, 0x09, 0x7E, 0x1C, 0x04, 0x08,
+  0xCA, 0xDF, 0x14, 0x1D, 0x7B, 0xE2, 0xEF, 0x23, 0x78, 0xFF, 0x0F, 0x02, 0x10, 0x7E, 0x31, 0xE7,
+  0xBE, 0xBD, 0xDF, 0xC2, 0xC7, 0x42, 0x05, 0x07, 0x3E, 0xED, 0xCA, 0xDE, 0xAA, 0x05, 0x75, 0x85,
+  0x7C, 0xF8, 0x1C, 0x2A, 0x06, 0x76, 0x08, 0xA6, 0xEB, 0x6F, 0x5B, 0x54, 0x3D, 0x5D, 0x65, 0xAC,
+  0xA5, 0x6F, 0x89, 0xED, 0x38, 0xDD, 0xEA, 0x94, 0x4B, 0xCA, 0x87, 0xB9, 0x70, 0x19, 0x1E, 0x62,
+  0xB3, 0x76, 0x1D, 0xC4, 0xF0, 0x10, 0x97, 0xAF, 0xDF, 0xF8, 0xB2, 0xAA, 0x3E, 0xD7, 0xC3, 0xF3,
+  0x39, 0x7E, 0xD2, 0x5D, 0xF0, 0x93, 0xEE, 0x42, 0x4A, 0x9E, 0x4C, 0x9C, 0xF0, 0x33, 0xE1, 0xE2,
+  0xC0, 0x61, 0x39, 0xB0, 0x70, 0xC6, 0x7D, 0x16, 0xCE, 0x78, 0x9F, 0x45, 0x58, 0x1D, 0x2B, 0x73,
+  0x46, 0x55, 0xB1, 0xAC, 0x2B, 0x01, 0x51, 0xF4, 0x6E, 0xDB, 0xBD, 0x34, 0x1B, 0x8A, 0x6B, 0x8E,
+  0x47, 0x6F, 0x01, 0x7F, 0xB3, 0x81, 0xCA, 0x6C, 0x45, 0xF3, 0xF2, 0x96, 0x26, 0xDE, 0xE9, 0x9C,
+  0x8A, 0xB4, 0x87, 0xCF, 0xAB, 0xED, 0x74, 0x95, 0x15, 0x11, 0xDA, 0x6A, 0x92, 0xD3, 0xD8, 0xC3,
+  0xFD, 0xE5, 0xE9, 0xFD, 0x37, 0xBC, 0x9A, 0x3B, 0x4C, 0xF1, 0xED, 0x41, 0x02, 0x1E, 0xE7, 0xEF,
+  0xEA, 0x16, 0x6F, 0x51, 0x64, 0x31, 0x2C, 0xB9, 0xA6, 0x10, 0x65, 0x27, 0xA6, 0xE8, 0x87, 0x5F,
+  0x02, 0x2D, 0xA3, 0xFF, 0xF4, 0x0F, 0x33, 0x4A, 0x03, 0xBA, 0x05, 0x86, 0xD3, 0xD6, 0x3D, 0xCE,
+  0x61, 0x79, 0x73, 0x1A, 0x6F, 0x95, 0x92, 0xC5, 0x52, 0xDC, 0xA6, 0x93, 0x8B, 0x28, 0xBE, 0x85,
+  0x80, 0x86, 0xB7, 0x23, 0x33, 0x2F, 0x70, 0xE5, 0x3B, 0xE9, 0x2B, 0xDD, 0xB9, 0x78, 0xB5, 0x11,
+  0xA2, 0x6B, 0x96, 0x7B, 0x4B, 0x5E, 0x0C, 0x7D, 0x0F, 0xCB, 0x65, 0x55, 0x81, 0x16, 0x85, 0x1B,
+  0x14, 0x1E, 0x9E, 0xB9, 0xE9, 0x3A, 0x8E, 0x35, 0x72, 0xB4, 0x66, 0xE5, 0xC7, 0x69, 0x8A, 0x56,
+  0x6E, 0x4F, 0x02, 0x85, 0xD4, 0xBE, 0x5D, 0x29, 0xDD, 0xF3, 0xBB, 0xDC, 0x23, 0xE2, 0x75, 0xE2,
+  0xEA, 0x91, 0xAB, 0xD8, 0xE1, 0x08, 0xEF, 0x6A, 0xE3, 0x8D, 0xEB, 0x12, 0x9F, 0x5F, 0x66, 0x45,
+  0x58, 0x3E, 0x87, 0x25, 0x44, 0x09, 0x14, 0x3C, 0xF0, 0x80, 0x5E, 0xC6, 0x6D, 0xF3, 0xEA, 0x64,
+  0xBD, 0xD7, 0x3E, 0x9F, 0x05, 0xD1, 0xAD, 0x40, 0x82, 0x25, 0x29, 0x22, 0xC1, 0xFB, 0x9C, 0x3C,
+  0x86, 0xBB, 0x64, 0x15, 0x6A, 0x73, 0x5E, 0x7F, 0xB0, 0xFF, 0xF9, 0x77, 0x34, 0xC0, 0x1D, 0x93,
+  0xC9, 0x63, 0x2C, 0xF3, 0x1E, 0xC7, 0xE3, 0x88, 0x61, 0x4F, 0xCA, 0x4E, 0xDF, 0x88, 0x41, 0x99,
+  0xD7, 0x68, 0x3B, 0xBF, 0xFA, 0xAD, 0x75, 0x57, 0x41, 0x61, 0x7F, 0x1C, 0xBD, 0xA9, 0xA0, 0x98,
+  0xCF, 0x95, 0xD6, 0xED, 0x84, 0xBB, 0xF2, 0xD8, 0xF8, 0xBE, 0xE4, 0x25, 0x21, 0xB3, 0xF3, 0xF2,
+  0xCA, 0x71, 0xC9, 0x51, 0x4C, 0x80, 0xC5, 0x9A, 0xB1, 0x2C, 0x95, 0xAB, 0x0B, 0x0F, 0x1F, 0x7F,
+  0x22, 0x32, 0x97, 0x03, 0x6F, 0x26, 0xA2, 0x2B, 0x41, 0x09, 0xE1, 0x7F, 0x05, 0x86, 0xE2, 0xB8,
+  0xFB, 0x5E, 0x3E, 0x64, 0x33, 0xF0, 0xBF, 0x62, 0xE5, 0xA5, 0xAE, 0x33, 0xFF, 0xB9, 0xDA, 0x88,
+  0x6E, 0x49, 0x7D, 0xCB, 0x1E, 0x90, 0xDA, 0xB6, 0x94, 0x79, 0x5B, 0x1E, 0x45, 0xC8, 0xA3, 0x08,
+  0xCA, 0x8C, 0xEB, 0x54, 0x4A, 0x50, 0x1F, 0x2B, 0x83, 0x10, 0xE4, 0x24, 0x5D, 0x14, 0xAB, 0xF2,
+  0xB3, 0xD1, 0xF0, 0xCD, 0xED, 0x72, 0x42, 0x1E, 0x54, 0x0F, 0xB2, 0x1D, 0x57, 0xEF, 0xCD, 0xCF,
+  0x7F, 0x6F, 0x6B, 0x57, 0x9D, 0xCF, 0x3F, 0xA6, 0x5F, 0xD3, 0xD5, 0x3B, 0x3F, 0x7B, 0x62, 0x57,
+  0xD4, 0xCF, 0x7A, 0x5D, 0xE1, 0x91, 0xFA, 0xE1, 0xAE, 0xE6, 0x97, 0xE5, 0x8D, 0xA6, 0xB6, 0x01,
+  0xA3, 0xD4, 0x57, 0x7A, 0xD6, 0xE9, 0x58, 0x05, 0x8F, 0xC2, 0x6D, 0xE4, 0xF7, 0x16, 0xCA, 0x3E,
+  0xD6, 0xA6, 0x0C, 0xE8, 0xE3, 0x94, 0x26, 0x92, 0xDE, 0xB7, 0x34, 0x23, 0xB8, 0xBF, 0x43, 0x73,
+  0x0F, 0xA2, 0x29, 0x9D, 0x2D, 0xF2, 0xF9, 0x9B, 0xE0, 0xF7, 0x75, 0xC1, 0x9A, 0xF6, 0x83, 0xC3,
+  0x55, 0x8E, 0xE7, 0x7F, 0xAD, 0x7A, 0x3D, 0xF0, 0x5B, 0x06, 0x5C, 0x38, 0xF2, 0x10, 0xDD, 0x9B,
+  0x38, 0x26, 0x7B, 0xB4, 0xD5, 0x25, 0x05, 0x4E, 0x8E, 0x92, 0x3C, 0xC4, 0xE1, 0x3C, 0x3D, 0xD4,
+  0xB3, 0xF9, 0xB4, 0xAE, 0xF7, 0x88, 0xAB, 0xAE, 0x05, 0xFD, 0x03, 0x2E, 0xB1, 0x17, 0xF5, 0x1A,
+  0xEB, 0xCB, 0x85, 0x25, 0xF7, 0x5C, 0xA3, 0xBC, 0xE0, 0x25, 0xF2, 0xC5, 0x0B, 0xAC, 0xEE, 0x2B,
+  0x6F, 0xB9, 0x5C, 0xE1, 0x75, 0xEA, 0x9E, 0x9F, 0x94, 0xF7, 0xEA, 0x2C, 0x2E, 0x43, 0x8B, 0xAF,
+  0xFD, 0x2F, 0xF0, 0x5D, 0x27, 0x89, 0xC8, 0x09, 0xFB, 0x7C, 0xED, 0x3E, 0x5F, 0xE7, 0xE9, 0x7C,
+  0x2F, 0xBC, 0x38, 0x3E, 0xCC, 0xD5, 0xE9, 0x73, 0x1D, 0x3D, 0x9D, 0xEB, 0xE7, 0x88, 0x1B, 0xF1,
+  0x20, 0xDF, 0xD1, 0x91, 0x91, 0xE0, 0x7F, 0xDB, 0xE3, 0xCA, 0xFC, 0xFA, 0xD2, 0x60, 0x70, 0xE6,
+  0x5E, 0x7A, 0xCC, 0x20, 0xA7, 0x78, 0x85, 0x49, 0x9E, 0x9F, 0x7B, 0xBB, 0xA2, 0x89, 0xA5, 0x78,
+  0xFE, 0xCA, 0x23, 0xC6, 0x54, 0x7C, 0x36, 0x2D, 0x78, 0x1A, 0x24, 0x60, 0x57, 0xFC, 0x00, 0xAD,
+  0xD3, 0x0D, 0x4F, 0xB2, 0x5C, 0x13, 0x9F, 0x47, 0x6F, 0x0E, 0x38, 0xE0, 0x09, 0xF3, 0x99, 0xD8,
+  0xA5, 0xE1, 0xB8, 0xFC, 0x51, 0x26, 0xE2, 0x8F, 0x97, 0xE4, 0x11, 0x9E, 0x98, 0x89, 0xD2, 0xC0,
+  0x95, 0xED, 0xB1, 0x55, 0xDB, 0x40, 0xFC, 0x49, 0xCB, 0x04, 0xAF, 0x5B, 0x40, 0xB9, 0xC9, 0x68,
+  0x30, 0x85, 0x7A, 0xC7, 0x63, 0x93, 0xD2, 0x9B, 0x1A, 0xA7, 0x14, 0x77, 0x45, 0xB0, 0x7B, 0xD1,
+  0xC9, 0x83, 0x3E, 0x09, 0xA0, 0x2A, 0xE1, 0x94, 0x45, 0x0D, 0x66, 0xE8, 0x96, 0x74, 0xBC, 0x6C,
+  0x39, 0x22, 0x1D, 0xBC, 0x34, 0xBD, 0x34, 0x8C, 0xC4, 0x62, 0xB8, 0xA3, 0x23, 0x6E, 0x31, 0x55,
+  0x3C, 0x5E, 0xB4, 0x58, 0x8C, 0x5F, 0x76, 0xE4, 0xC4, 0x6C, 0x27, 0xD5, 0x5F, 0xC7, 0x83, 0x6B,
+  0x35, 0x93, 0xF8, 0xC2, 0x7F, 0xFE, 0xE9, 0xD3, 0x87, 0xCF, 0xEF, 0xC9, 0xDF, 0x5A, 0xC1, 0xEC,
+  0xC3, 0xF1, 0x34, 0x62, 0x0D, 0xEC, 0xF1, 0xF3, 0x17, 0xFD, 0x04, 0xC8, 0x6F, 0xEC, 0xF0, 0xE2,
+  0xA4, 0x1A, 0xE8, 0x56, 0x6C, 0x94, 0x79, 0x51, 0x23, 0x97, 0x7F, 0x77, 0x86, 0x57, 0x87, 0xF6,
+  0x6E, 0x50, 0x5A, 0x84, 0xDF, 0x35, 0xC6, 0x2B, 0x01, 0x14, 0xCA, 0xAB, 0x95, 0x57, 0x14, 0x1B,
+  0x18, 0xAF, 0x9E, 0x03, 0x13, 0x5E, 0xB5, 0xC9, 0xF5, 0x9D, 0x60, 0xE8, 0xBB, 0x53, 0x72, 0x15,
+  0xED, 0x92, 0xCB, 0x20, 0xF0, 0x09, 0x0B, 0xF5, 0xF6, 0xDF, 0xD9, 0xB4, 0x6F, 0x2B, 0x1D, 0xF1,
+  0x71, 0x3E, 0x00, 0xE0, 0x98, 0xAD, 0x3A, 0x08, 0x41, 0x78, 0xA5, 0xBB, 0x07, 0x12, 0x97, 0xB7,
+  0xBB, 0x4C, 0x86, 0xBC, 0xDC, 0xC2, 0x87, 0xD2, 0x73, 0x87, 0xFC, 0xEF, 0xF1, 0xFE, 0x09, 0x9E,
+  0xC1, 0x3F, 0x27, 0x9F, 0x37, 0x00, 0x00,
+};
 
+// favicon.ico 1150 bytes, 1150 minified, 323 gzipped
+#define FAVICON_ETAG "\"99ee4199\""
 const uint8_t favicon[] PROGMEM = {
-  0x1F, 0x8B, 0x08, 0x08, 0x70, 0xC9, 0xE2, 0x59, 0x04, 0x00, 0x66, 0x61, 0x76, 0x69, 0x63, 0x6F, 
-  0x6E, 0x2E, 0x69, 0x63, 0x6F, 0x00, 0xD5, 0x94, 0x31, 0x4B, 0xC3, 0x50, 0x14, 0x85, 0x4F, 0x6B, 
-  0xC0, 0x52, 0x0A, 0x86, 0x22, 0x9D, 0xA4, 0x74, 0xC8, 0xE0, 0x28, 0x46, 0xC4, 0x41, 0xB0, 0x53, 
-  0x7F, 0x87, 0x64, 0x72, 0x14, 0x71, 0xD7, 0xB5, 0x38, 0x38, 0xF9, 0x03, 0xFC, 0x05, 0x1D, 0xB3, 
-  0x0A, 0x9D, 0x9D, 0xA4, 0x74, 0x15, 0x44, 0xC4, 0x4D, 0x07, 0x07, 0x89, 0xFA, 0x3C, 0x97, 0x9C, 
-  0xE8, 0x1B, 0xDA, 0x92, 0x16, 0x3A, 0xF4, 0x86, 0x8F, 0x77, 0x73, 0xEF, 0x39, 0xEF, 0xBD, 0xBC, 
-  0x90, 0x00, 0x15, 0x5E, 0x61, 0x68, 0x63, 0x07, 0x27, 0x01, 0xD0, 0x02, 0xB0, 0x4D, 0x58, 0x62, 
-  0x25, 0xAF, 0x5B, 0x74, 0x03, 0xAC, 0x54, 0xC4, 0x71, 0xDC, 0x35, 0xB0, 0x40, 0xD0, 0xD7, 0x24, 
-  0x99, 0x68, 0x62, 0xFE, 0xA8, 0xD2, 0x77, 0x6B, 0x58, 0x8E, 0x92, 0x41, 0xFD, 0x21, 0x79, 0x22, 
-  0x89, 0x7C, 0x55, 0xCB, 0xC9, 0xB3, 0xF5, 0x4A, 0xF8, 0xF7, 0xC9, 0x27, 0x71, 0xE4, 0x55, 0x38, 
-  0xD5, 0x0E, 0x66, 0xF8, 0x22, 0x72, 0x43, 0xDA, 0x64, 0x8F, 0xA4, 0xE4, 0x43, 0xA4, 0xAA, 0xB5, 
-  0xA5, 0x89, 0x26, 0xF8, 0x13, 0x6F, 0xCD, 0x63, 0x96, 0x6A, 0x5E, 0xBB, 0x66, 0x35, 0x6F, 0x2F, 
-  0x89, 0xE7, 0xAB, 0x93, 0x1E, 0xD3, 0x80, 0x63, 0x9F, 0x7C, 0x9B, 0x46, 0xEB, 0xDE, 0x1B, 0xCA, 
-  0x9D, 0x7A, 0x7D, 0x69, 0x7B, 0xF2, 0x9E, 0xAB, 0x37, 0x20, 0x21, 0xD9, 0xB5, 0x33, 0x2F, 0xD6, 
-  0x2A, 0xF6, 0xA4, 0xDA, 0x8E, 0x34, 0x03, 0xAB, 0xCB, 0xBB, 0x45, 0x46, 0xBA, 0x7F, 0x21, 0xA7, 
-  0x64, 0x53, 0x7B, 0x6B, 0x18, 0xCA, 0x5B, 0xE4, 0xCC, 0x9B, 0xF7, 0xC1, 0xBC, 0x85, 0x4E, 0xE7, 
-  0x92, 0x15, 0xFB, 0xD4, 0x9C, 0xA9, 0x18, 0x79, 0xCF, 0x95, 0x49, 0xDB, 0x98, 0xF2, 0x0E, 0xAE, 
-  0xC8, 0xF8, 0x4F, 0xFF, 0x3F, 0xDF, 0x58, 0xBD, 0x08, 0x25, 0x42, 0x67, 0xD3, 0x11, 0x75, 0x2C, 
-  0x29, 0x9C, 0xCB, 0xF9, 0xB9, 0x00, 0xBE, 0x8E, 0xF2, 0xF1, 0xFD, 0x1A, 0x78, 0xDB, 0x00, 0xEE, 
-  0xD6, 0x80, 0xE1, 0x90, 0xFF, 0x90, 0x40, 0x1F, 0x04, 0xBF, 0xC4, 0xCB, 0x0A, 0xF0, 0xB8, 0x6E, 
-  0xDA, 0xDC, 0xF7, 0x0B, 0xE9, 0xA4, 0xB1, 0xC3, 0x7E, 0x04, 0x00, 0x00, 
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xD5, 0x94, 0xB1, 0x4B, 0xC3, 0x40,
+  0x18, 0xC5, 0x5F, 0x6B, 0xC0, 0x52, 0x0A, 0x86, 0x22, 0x9D, 0xA4, 0x74, 0xC8, 0xE0, 0x28, 0x46,
+  0xC4, 0x41, 0xB0, 0x53, 0xFF, 0x0E, 0xC9, 0xE4, 0x28, 0xE2, 0x5E, 0xD7, 0xE2, 0xE0, 0xD4, 0x3F,
+  0xC0, 0xBF, 0xA0, 0x63, 0x56, 0xA1, 0xB3, 0x93, 0x94, 0xAE, 0x82, 0x48, 0xE9, 0x66, 0x87, 0x0E,
+  0xA5, 0xD6, 0xF8, 0x3E, 0xF2, 0x0E, 0x6E, 0x68, 0x4B, 0x2D, 0x74, 0x30, 0xE1, 0x97, 0xBB, 0xBC,
+  0xEF, 0x7B, 0x77, 0x97, 0xCB, 0xDD, 0x01, 0x05, 0xDE, 0x61, 0x08, 0x3E, 0x1B, 0xB8, 0x09, 0x80,
+  0x1A, 0x80, 0x63, 0x42, 0x89, 0x4A, 0xAE, 0xDB, 0xD5, 0x0C, 0xF0, 0xAF, 0xAE, 0x38, 0x8E, 0x9B,
+  0xC6, 0x96, 0xDE, 0x2A, 0x99, 0x8B, 0xEA, 0x16, 0x4D, 0x14, 0xE9, 0x7B, 0x36, 0xAC, 0xFE, 0x87,
+  0x7E, 0x2F, 0xC9, 0x07, 0x49, 0xE4, 0xB3, 0x76, 0x12, 0xF2, 0x69, 0xB1, 0x0D, 0xFC, 0xE7, 0x64,
+  0x46, 0x32, 0x32, 0x16, 0x99, 0xB4, 0x8B, 0x35, 0xBE, 0x88, 0x74, 0x49, 0x9D, 0x9C, 0x91, 0x94,
+  0x4C, 0x45, 0x2A, 0xAD, 0xAE, 0x9C, 0x68, 0x89, 0x3F, 0xF1, 0xFA, 0xBC, 0xA6, 0x54, 0xF2, 0xC2,
+  0x25, 0xD3, 0xBC, 0xB1, 0x24, 0x9E, 0xAF, 0x4C, 0x5A, 0xAC, 0x06, 0x2C, 0x3B, 0x64, 0xA1, 0x1C,
+  0xEB, 0xF7, 0x55, 0x4C, 0xA5, 0x59, 0xAC, 0xA3, 0xDC, 0x96, 0xBC, 0xF7, 0x8A, 0xF5, 0x48, 0x48,
+  0x4E, 0x35, 0xEF, 0xAE, 0x2F, 0x37, 0x26, 0xD3, 0x4E, 0x94, 0xD3, 0x93, 0x6E, 0xDE, 0x23, 0x32,
+  0xD0, 0xFB, 0x88, 0xDC, 0x92, 0x43, 0x8D, 0xAD, 0x62, 0xA8, 0x5E, 0x23, 0x77, 0x5E, 0xBB, 0x6F,
+  0xE6, 0xF5, 0xF2, 0xBA, 0x5A, 0x2B, 0x6E, 0x9C, 0x03, 0xCD, 0x5B, 0xAA, 0xBA, 0xFB, 0xAE, 0xB9,
+  0x72, 0x2B, 0x2B, 0xFE, 0xC1, 0x23, 0x19, 0x7A, 0xF9, 0xAE, 0xBD, 0xA1, 0x62, 0xD1, 0x86, 0xEB,
+  0xC8, 0xE6, 0xA6, 0x21, 0xCA, 0xBB, 0xDA, 0x63, 0x59, 0x96, 0xF3, 0xD3, 0x06, 0xBE, 0xAF, 0xF2,
+  0x72, 0xF2, 0x04, 0x7C, 0x1D, 0x00, 0x2F, 0x7B, 0x40, 0xBF, 0xCF, 0x33, 0x44, 0xE7, 0x46, 0x91,
+  0x3B, 0xF1, 0xA1, 0x00, 0xBC, 0xEF, 0xE7, 0xB9, 0xE6, 0xFB, 0x05, 0xE9, 0xA4, 0xB1, 0xC3, 0x7E,
+  0x04, 0x00, 0x00,
 };
@@ -0,0 +1,101 @@
+#include "presence.h"
+#include "occupancy.h"
+
+const prActions prAction[PE_CNT] =
+{
+  {0, 0},                                                            // PE_NONE
+  {PA_STATE | PA_SCREEN | PA_LIGHT_ON, 0},                           // PE_ARRIVE
+  {PA_STATE | PA_LIGHT_STOP | PA_LIGHT_OFF | PA_FAN_OFF, 0},         // PE_LEAVE
+  {PA_LIGHT_WAIT | PA_FAN_ON, 3000},                                 // PE_IN_BED
+  {PA_SCREEN | PA_LIGHT_STOP | PA_LIGHT_ON | PA_FAN_OFF, 8000},      // PE_OUT_BED
+};
+
+void Presence::pir(bool bHigh, uint32_t ms)
+{
+  if(bHigh == m_bPir)
+    return;
+  m_bPir = bHigh;
+  m_inputs[PI_PIR]++;
+  if(bHigh)
+    m_pirMs = ms;
+  else if(ms - m_pirMs < PR_PIR_ON) // too short to count
+    m_flaps++;
+}
+
+void Presence::radar(uint8_t occCls, uint32_t ms)
+{
+  if(!m_bRadar || occCls != m_radarCls)
+    m_inputs[PI_RADAR]++;
+  m_bRadar = true;
+  m_radarCls = occCls;
+  m_radarMs = ms;
+}
+
+void Presence::activity(uint8_t input, uint32_t ms)
+{
+  m_inputs[input]++;
+  m_bAct = true;
+  m_actMs = ms;
+}
+
+uint8_t Presence::update(uint32_t ms)
+{
+  if(m_bAct && ms - m_actMs >= PR_ACT_HOLD)
+    m_bAct = false;
+  if(m_bRadar && ms - m_radarMs >= PR_RADAR_STALE) // sensor stopped, don't hold the room on its last class
+    m_bRadar = false;
+
+  bool bSeen = m_bAct || (m_bPir && ms - m_pirMs >= PR_PIR_ON)
+    || (m_bRadar && m_radarCls != OCC_EMPTY);
+  bool bInBed = m_bRadar && (m_radarCls == OCC_BED || m_radarCls == OCC_RESTLESS);
+
+  if(bSeen)
+  {
+    if(m_bHolding)
+      m_flaps++;
+    m_bHolding = false;
+    m_seenMs = ms;
+  }
+
+  uint8_t ev = PE_NONE;
+
+  switch(m_state)
+  {
+    case PS_AWAY:
+      if(bSeen)
+      {
+        m_state = PS_ROOM; // in bed is the next step
+        ev = PE_ARRIVE;
+      }
+      break;
+    case PS_ROOM:
+      if(bInBed)
+      {
+        m_state = PS_BED;
+        ev = PE_IN_BED;
+      }
+      break;
+    case PS_BED:
+      if(m_radarCls == OCC_ROOM)
+      {
+        m_state = PS_ROOM;
+        ev = PE_OUT_BED;
+      }
+      break;
+  }
+
+  if(m_state != PS_AWAY && !bSeen)
+  {
+    m_bHolding = true;
+    if(ms - m_seenMs >= PR_AWAY_HOLD)
+    {
+      m_state = PS_AWAY;
+      m_bHolding = false;
+      ev = PE_LEAVE;
+    }
+  }
+
+  if(ev)
+    m_events[ev]++;
+  return ev;
+}
@@ -0,0 +1,92 @@
+#ifndef PRESENCE_H
+#define PRESENCE_H
+
+#include <Arduino.h>
+
+#define PR_PIR_ON     1000   // ms the PIR must stay high to count
+#define PR_ACT_HOLD   60000  // ms a touch or button press counts as someone there
+#define PR_AWAY_HOLD  30000  // ms with nothing from any input before the room is empty
+#define PR_RADAR_STALE 10000 // ms without a radar class before it stops counting
+
+enum prState
+{
+  PS_AWAY,
+  PS_ROOM,
+  PS_BED,    // radar only
+};
+
+enum prEvent
+{
+  PE_NONE,
+  PE_ARRIVE,
+  PE_LEAVE,
+  PE_IN_BED,
+  PE_OUT_BED,
+  PE_CNT
+};
+
+// What each event does, presenceEvent() in Waterbed2.ino and tools/radarReplay both go by prAction[]
+#define PA_STATE      0x0001  // push the state
+#define PA_SCREEN     0x0002  // wake the screen
+#define PA_LIGHT_ON   0x0004
+#define PA_LIGHT_OFF  0x0008
+#define PA_LIGHT_WAIT 0x0010  // light off after PR_LIGHT_WAIT
+#define PA_LIGHT_STOP 0x0020  // cancel the wait
+#define PA_FAN_ON     0x0040
+#define PA_FAN_OFF    0x0080
+
+#define PR_LIGHT_WAIT 5000    // ms the light stays on after getting in bed
+
+struct prActions
+{
+  uint16_t flags;
+  uint16_t chimeMs; // 0 for none
+};
+
+extern const prActions prAction[PE_CNT];
+
+enum prInput
+{
+  PI_PIR,
+  PI_RADAR,
+  PI_TOUCH,
+  PI_BUTTON,
+  PI_CNT
+};
+
+// One occupancy model for the PIR, radar classifier, touch screen and button.  The inputs only
+// record what they saw, update() works out the state with the hold times and returns at most
+// one event per call, so the lights, fan, state pushes and screen see a single debounced stream.
+// Only the radar can put someone in or out of bed, a touch from the bed doesn't get them up.
+// Leaving straight from bed is PE_LEAVE alone, so inBed() is what to publish, not the events.
+class Presence
+{
+public:
+  Presence(){}
+  void pir(bool bHigh, uint32_t ms);
+  void radar(uint8_t occCls, uint32_t ms); // occClass from Occupancy
+  void activity(uint8_t input, uint32_t ms); // PI_TOUCH, PI_BUTTON
+  uint8_t update(uint32_t ms);  // next prEvent
+  uint8_t state(void){ return m_state; }
+  bool present(void){ return m_state != PS_AWAY; }
+  bool inBed(void){ return m_state == PS_BED; }
+
+  uint32_t m_events[PE_CNT];
+  uint32_t m_inputs[PI_CNT];  // edges and presses seen
+  uint32_t m_flaps;           // input changes absorbed by the holds
+private:
+  uint8_t  m_state;
+  uint8_t  m_radarCls;
+  bool     m_bRadar;    // radar is feeding, it owns the bed
+  bool     m_bPir;
+  bool     m_bAct;
+  bool     m_bHolding;  // nothing seen, waiting out PR_AWAY_HOLD
+  uint32_t m_pirMs;     // rising edge
+  uint32_t m_radarMs;   // last class
+  uint32_t m_actMs;
+  uint32_t m_seenMs;
+};
+
+extern Presence presence;
+
+#endif // PRESENCE_H
@@ -0,0 +1,138 @@
+#include "respCache.h"
+#include "eeMem.h" // for jsonString
+#include "jsonstring.h"
+
+RespCache::RespCache()
+{
+  for(uint8_t i = 0; i < RC_CNT; i++)
+    m_ent[i].ver = 1; // built = 0, nothing cached
+#ifdef ESP32
+  m_mutex = xSemaphoreCreateMutex();
+#endif
+}
+
+void RespCache::add(uint8_t sec, String (*fn)(void), bool bLoop)
+{
+  m_ent[sec].fn = fn;
+  m_ent[sec].bLoop = bLoop;
+  if(m_bootId == 0)
+  {
+#ifdef ESP32
+    m_bootId = esp_random() | 1;
+#else
+    m_bootId = ESP.random() | 1;
+#endif
+  }
+}
+
+// the bodies are shared by the web server's task and loop()
+void RespCache::lock()
+{
+#ifdef ESP32
+  xSemaphoreTake(m_mutex, portMAX_DELAY);
+#endif
+}
+
+void RespCache::unlock()
+{
+#ifdef ESP32
+  xSemaphoreGive(m_mutex);
+#endif
+}
+
+void RespCache::changed(uint8_t sec)
+{
+  m_ent[sec].ver++;
+}
+
+void RespCache::build(uint8_t sec)
+{
+  rcEntry &e = m_ent[sec];
+  uint32_t ver = e.ver;
+
+  if(e.built == ver)
+    return;
+  String s = e.fn(); // the data doesn't change under loop(), only the swap is locked
+  lock();
+  e.body = s;
+  e.built = ver;
+  e.builds++;
+  unlock();
+}
+
+String RespCache::get(uint8_t sec, uint32_t *pVer)
+{
+  rcEntry &e = m_ent[sec];
+  String s;
+
+  lock();
+  uint32_t ver = e.bLoop ? e.built : (uint32_t)e.ver;
+  if(e.built != ver)
+  {
+    e.body = e.fn();
+    e.built = ver;
+    e.builds++;
+  }
+  else
+    e.hits++;
+  s = e.body;
+  unlock();
+
+  if(pVer)
+    *pVer = ver;
+  return s;
+}
+
+uint32_t RespCache::version(uint8_t sec) // of the body get() would give
+{
+  if(!m_ent[sec].bLoop)
+    return m_ent[sec].ver;
+  lock();
+  uint32_t ver = m_ent[sec].built;
+  unlock();
+  return ver;
+}
+
+String RespCache::etag(uint8_t sec, uint32_t ver)
+{
+  String s = "\"";
+  s += String(m_bootId, HEX);
+  s += "-";
+  s += sec;
+  s += "-";
+  s += ver;
+  s += "\"";
+  return s;
+}
+
+void RespCache::send(AsyncWebServerRequest *request, uint8_t sec)
+{
+  AsyncWebServerResponse *response;
+  uint32_t ver = version(sec);
+
+  if(request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == etag(sec, ver))
+  {
+    m_ent[sec].notMod++;
+    response = request->beginResponse(304);
+  }
+  else
+  {
+    String s = get(sec, &ver);
+    response = request->beginResponse(200, "text/json", s);
+  }
+  response->addHeader("ETag", etag(sec, ver));
+  request->send(response);
+}
+
+String RespCache::statsJson()
+{
+  jsonString js;
+
+  for(uint8_t i = 0; i < RC_CNT; i++)
+  {
+    static const char *pName[] = {"state", "set", "hist"};
+    uint32_t a[3] = {m_ent[i].builds, m_ent[i].hits, m_ent[i].notMod};
+    js.Array(pName[i], a, 3); // builds, hits, 304s
+  }
+  return js.Close();
+}
@@ -0,0 +1,56 @@
+#ifndef RESPCACHE_H
+#define RESPCACHE_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <atomic>
+
+enum rcSection
+{
+  RC_STATE,   // dataJson()
+  RC_SET,     // setJson()
+  RC_HIST,    // ta.get()
+  RC_CNT
+};
+
+struct rcEntry
+{
+  String (*fn)(void);
+  std::atomic<uint32_t> ver; // bumped by loop() when the data changes
+  uint32_t built;            // version the body was made from
+  String   body;
+  bool     bLoop;            // fn() reads what loop() writes, only build() makes it
+  uint32_t hits;
+  uint32_t builds;
+  uint32_t notMod;           // 304s sent
+};
+
+// Serialized replies are kept until their section's version changes, so polling and
+// websocket connects don't rebuild the same JSON, and HTTP clients with the ETag get a 304.
+// A section added with bLoop is rebuilt by loop() calling build(), other tasks get the last copy
+class RespCache
+{
+public:
+  RespCache();
+  void add(uint8_t sec, String (*fn)(void), bool bLoop = false);
+  void changed(uint8_t sec);
+  void build(uint8_t sec); // loop() only
+  String get(uint8_t sec, uint32_t *pVer = NULL);
+  void send(AsyncWebServerRequest *request, uint8_t sec); // 200 with an ETag, or 304
+  String statsJson(void);
+private:
+  String etag(uint8_t sec, uint32_t ver);
+  uint32_t version(uint8_t sec);
+  void lock(void);
+  void unlock(void);
+
+  rcEntry  m_ent[RC_CNT];
+  uint32_t m_bootId;  // in the ETag so a restart doesn't match old ones
+#ifdef ESP32
+  SemaphoreHandle_t m_mutex;
+#endif
+};
+
+extern RespCache respCache;
+
+#endif // RESPCACHE_H
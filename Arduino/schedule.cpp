@@ -0,0 +1,183 @@
+#include "schedule.h"
+
+uint8_t Schedule::first(uint8_t season)
+{
+  uint8_t idx = 0;
+  for(uint8_t i = 0; i < season; i++)
+    idx += ee.schedCnt[i];
+  return idx;
+}
+
+uint8_t Schedule::count(uint8_t season)
+{
+  return ee.schedCnt[season];
+}
+
+// total pool entries in use
+uint8_t Schedule::used()
+{
+  return first(4);
+}
+
+Sched& Schedule::item(uint8_t season, uint8_t i)
+{
+  return ee.schedule[first(season) + i];
+}
+
+// grow or shrink a season.  New entries are copies of the last one
+bool Schedule::setCount(uint8_t season, uint8_t n)
+{
+  n = constrain(n, 1, MAX_SCHED);
+  uint8_t cnt = ee.schedCnt[season];
+  uint8_t total = used();
+  uint8_t end = first(season) + cnt;
+
+  if(n == cnt)
+    return true;
+  if(n > cnt)
+  {
+    uint8_t add = n - cnt;
+    if(total + add > SCHED_POOL)
+      return false; // pool is full
+    memmove(&ee.schedule[end + add], &ee.schedule[end], (total - end) * sizeof(Sched));
+    for(uint8_t i = 0; i < add; i++)
+      ee.schedule[end + i] = ee.schedule[end - 1];
+  }
+  else
+  {
+    uint8_t del = cnt - n;
+    memmove(&ee.schedule[end - del], &ee.schedule[end], (total - end) * sizeof(Sched));
+    memset(&ee.schedule[total - del], 0, del * sizeof(Sched));
+  }
+  ee.schedCnt[season] = n;
+  return true;
+}
+
+// Replace a season from "[[time,temp,thresh,wday],...]", or all seasons with season=SCHED_ALL
+// from "[[[...],...],[...],[...],[...]]".  Nothing is changed unless every entry is valid
+bool Schedule::load(uint8_t season, char *p, uint16_t tMin, uint16_t tMax)
+{
+  Sched tmp[SCHED_POOL];
+  uint8_t cnt[4];
+  uint8_t n = 0;
+  uint8_t depth = 0, entDepth = (season == SCHED_ALL) ? 3 : 2;
+  int8_t s = (season == SCHED_ALL) ? -1 : season;
+  float v[4];
+  uint8_t vi = 0;
+
+  if(season > SCHED_ALL)
+    return false;
+  memset(cnt, 0, sizeof(cnt));
+
+  while(*p)
+  {
+    switch(*p)
+    {
+      case '[':
+        if(++depth > entDepth)
+          return false;
+        if(depth == entDepth)
+          vi = 0;
+        else if(depth == 2 && ++s > 3) // next season
+          return false;
+        p++;
+        break;
+      case ']':
+        if(depth == 0)
+          return false;
+        if(depth == entDepth)
+        {
+          if(vi < 3 || n >= SCHED_POOL || s < 0 || cnt[s] >= MAX_SCHED)
+            return false;
+          float t = v[1] * 10 + 0.5, th = v[2] * 10 + 0.5; // checked before they are narrowed
+          if(v[0] < 0 || v[0] >= 24*60 || v[3] < 0 || v[3] > 0x7F)
+            return false;
+          if(!(t >= tMin && t < tMax + 1) || !(th >= 1 && th < 101))
+            return false;
+          tmp[n].timeSch = v[0];
+          tmp[n].setTemp = t;
+          tmp[n].thresh = th;
+          tmp[n].wday = v[3];
+          cnt[s]++;
+          n++;
+        }
+        depth--;
+        p++;
+        break;
+      case ',': case ' ': case '\r': case '\n': case '\t':
+        p++;
+        break;
+      default:
+        {
+          char *pEnd;
+          if(depth != entDepth || vi >= 4)
+            return false;
+          v[vi] = strtod(p, &pEnd);
+          if(pEnd == p)
+            return false;
+          if(vi < 3) v[3] = 0;
+          vi++;
+          p = pEnd;
+        }
+        break;
+    }
+  }
+  if(depth)
+    return false;
+
+  if(season == SCHED_ALL)
+  {
+    for(uint8_t i = 0; i < 4; i++)
+      if(cnt[i] == 0)
+        return false;
+    memcpy(ee.schedule, tmp, n * sizeof(Sched));
+    memset(&ee.schedule[n], 0, (SCHED_POOL - n) * sizeof(Sched));
+    memcpy(ee.schedCnt, cnt, sizeof(cnt));
+    return true;
+  }
+  if(n == 0 || used() - ee.schedCnt[season] + n > SCHED_POOL)
+    return false;
+  setCount(season, n);
+  memcpy(&item(season, 0), tmp, n * sizeof(Sched));
+  return true;
+}
+
+// build the time sorted list of entries for a weekday (1=Sunday)
+void Schedule::compile(uint8_t season, uint8_t wday)
+{
+  uint8_t start = first(season);
+  uint8_t bit = 1 << (wday - 1);
+
+  m_daySeason = season;
+  m_dayCnt = 0;
+  for(uint8_t i = start; i < start + ee.schedCnt[season]; i++)
+  {
+    if(ee.schedule[i].wday && (ee.schedule[i].wday & bit) == 0)
+      continue;
+    uint8_t n = m_dayCnt++;
+    while(n && ee.schedule[m_day[n-1]].timeSch > ee.schedule[i].timeSch) // insertion sort
+    {
+      m_day[n] = m_day[n-1];
+      n--;
+    }
+    m_day[n] = i;
+  }
+  if(m_dayCnt == 0) // nothing for today, use the first entry
+    m_day[m_dayCnt++] = start;
+}
+
+uint8_t Schedule::dayCnt()
+{
+  return m_dayCnt;
+}
+
+Sched& Schedule::day(uint8_t i)
+{
+  return ee.schedule[m_day[i]];
+}
+
+// season item index of a day entry
+uint8_t Schedule::dayItem(uint8_t i)
+{
+  return m_day[i] - first(m_daySeason);
+}
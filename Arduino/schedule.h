@@ -0,0 +1,35 @@
+#ifndef SCHEDULE_H
+#define SCHEDULE_H
+
+#include <Arduino.h>
+#include "eeMem.h"
+
+#define SCHED_PAGE 16  // entries per json page
+#define SCHED_ALL   4  // season value for all seasons
+
+// Seasons are stored back to back in ee.schedule[], ee.schedCnt[] entries each.
+// compile() builds the sorted list of entries active for one weekday.
+class Schedule
+{
+public:
+  Schedule(){}
+  uint8_t count(uint8_t season);
+  uint8_t used(void);
+  Sched& item(uint8_t season, uint8_t i);
+  bool setCount(uint8_t season, uint8_t n);
+  bool load(uint8_t season, char *p, uint16_t tMin, uint16_t tMax);
+  void compile(uint8_t season, uint8_t wday);
+  uint8_t dayCnt(void);
+  Sched& day(uint8_t i);
+  uint8_t dayItem(uint8_t i);
+private:
+  uint8_t first(uint8_t season);
+
+  uint8_t m_day[MAX_SCHED]; // pool indexes sorted by time
+  uint8_t m_dayCnt;
+  uint8_t m_daySeason;
+};
+
+extern Schedule sched;
+
+#endif // SCHEDULE_H
@@ -0,0 +1,133 @@
+#include "sensors.h"
+#include "tasks.h"
+#include "eeMem.h" // for jsonString
+#include "jsonstring.h"
+#include <OneWire.h>
+#include <SHT21.h>
+
+extern OneWire ds;
+extern byte ds_addr[8];
+extern SHT21 sht;
+
+void Sensors::start()
+{
+  if(m_bStarted)
+    return;
+  m_bStarted = true;
+  m_dsMs = millis() - DS_PERIOD; // first conversion now
+#ifdef ESP32
+  xTaskCreatePinnedToCore(task, "sensors", 4096, this, 2, NULL, 0);
+#endif
+}
+
+void Sensors::startRadar(Stream *pStream)
+{
+  m_pRadar = pStream;
+}
+
+void Sensors::service()
+{
+#ifndef ESP32
+  if(m_bStarted)
+    acquire();
+#endif
+}
+
+#ifdef ESP32
+void Sensors::task(void *param)
+{
+  Sensors *pThis = (Sensors *)param;
+
+  for(;;)
+  {
+    pThis->acquire();
+    vTaskDelay(pdMS_TO_TICKS(SENS_POLL));
+  }
+}
+#endif
+
+void Sensors::acquire()
+{
+  uint32_t ms = millis();
+
+  switch(m_dsState)
+  {
+    case 0: // start a conversion
+      if(ms - m_dsMs < DS_PERIOD)
+        break;
+      m_dsMs = ms;
+      ds.reset();
+      ds.select(ds_addr);
+      ds.write(0x44, 0);   // start conversion, no parasite power on at the end
+      m_dsState = 1;
+      break;
+    case 1:
+      if(ms - m_dsMs < DS_CONV)
+        break;
+      readDs(ms);
+      m_dsState = 0;
+      break;
+  }
+
+  if(sht.service())
+  {
+    shtSample s;
+    s.ms = ms;
+    s.tempC = sht.getTemperatureC();
+    s.tempF = sht.getTemperatureF();
+    s.rh = sht.getRh();
+    m_shtq.push(s);
+    tasks.wake();
+  }
+
+  if(m_pRadar == NULL)
+    return;
+  while(m_pRadar->available()) // every frame, ~10 Hz in engineering mode
+  {
+    if(m_ld.feed(m_pRadar->read()))
+    {
+      m_ld.m_s.ms = ms;
+      m_radarq.push(m_ld.m_s);
+      tasks.wake();
+    }
+  }
+}
+
+void Sensors::readDs(uint32_t ms)
+{
+  dsSample s;
+  uint8_t data[10];
+
+  s.ms = ms;
+  s.raw = 0;
+  s.status = DS_OK;
+
+  uint8_t present = ds.reset();
+  ds.select(ds_addr);
+  ds.write(0xBE);         // Read Scratchpad
+
+  if(!present)
+    s.status = DS_MISSING;
+  else
+  {
+    for( int i = 0; i < 9; i++)          // we need 9 bytes
+      data[i] = ds.read();
+    if(OneWire::crc8( data, 8) != data[8])
+      s.status = DS_CRC;
+    else
+      s.raw = (data[1] << 8) | data[0];
+  }
+  m_dsq.push(s);
+}
+
+String Sensors::statsJson()
+{
+  jsonString js;
+
+  js.Var("dsDrop", m_dsq.m_drops);
+  js.Var("shtDrop", m_shtq.m_drops);
+  js.Var("radarDrop", m_radarq.m_drops);
+  js.Var("radarFrames", m_ld.m_frames);
+  js.Var("radarBad", m_ld.m_bad);
+  return js.Close();
+}
@@ -0,0 +1,65 @@
+#ifndef SENSORS_H
+#define SENSORS_H
+
+#include <Arduino.h>
+#include "spscRing.h"
+#include "ldFrame.h"
+
+#define SENS_POLL    10    // ms between sensor task passes
+#define DS_CONV      1000  // ms given to a DS18B20 conversion
+#define DS_PERIOD    3000  // ms between DS18B20 reads
+
+enum dsStatus
+{
+  DS_OK,
+  DS_MISSING,
+  DS_CRC,
+};
+
+struct dsSample
+{
+  uint32_t ms;      // millis() when read
+  uint16_t raw;     // 1/16 C
+  uint8_t  status;
+};
+
+struct shtSample
+{
+  uint32_t ms;
+  float    tempC;
+  float    tempF;
+  float    rh;
+};
+
+// Reads the DS18B20, SHT21 and radar and queues timestamped samples for loop().
+// On ESP32 this runs in its own task on core 0, so serial parsing and one-wire timing never
+// hold up the heater control, touch handling or web callbacks on core 1.
+class Sensors
+{
+public:
+  Sensors(){}
+  void start(void);       // after ds.search() and sht.init()
+  void startRadar(Stream *pStream);  // after radar.begin() and engineering mode is on
+  void service(void);     // ESP8266, call from loop()
+  String statsJson(void);
+
+  SpscRing<dsSample, 4>     m_dsq;
+  SpscRing<shtSample, 4>    m_shtq;
+  SpscRing<radarSample, 16> m_radarq;
+
+private:
+  void acquire(void);
+  void readDs(uint32_t ms);
+#ifdef ESP32
+  static void task(void *param);
+#endif
+  uint32_t m_dsMs;
+  LdFrame  m_ld;
+  Stream * volatile m_pRadar;  // set once by loop()
+  uint8_t  m_dsState;
+  bool m_bStarted;
+};
+
+extern Sensors sensors;
+
+#endif // SENSORS_H
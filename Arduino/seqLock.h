@@ -0,0 +1,49 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+// One writer publishes a struct, readers in other tasks get a consistent copy.
+// Double buffered with a sequence count: the writer never waits, and a reader only retries
+// if the writer got around to the buffer it was copying, so a reader that preempts the
+// writer can't spin on it
+template <class T>
+class SeqLock
+{
+public:
+  SeqLock()
+  {
+    memset(m_buf, 0, sizeof(m_buf));
+  }
+
+  void write(const T &v) // writer
+  {
+    uint32_t s = m_seq.load(std::memory_order_relaxed); // even
+    T *p = &m_buf[((s >> 1) + 1) & 1];                  // the buffer not being read
+
+    m_seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy((void *)p, &v, sizeof(T));
+    m_seq.store(s + 2, std::memory_order_release);
+  }
+
+  void read(T &v) // any task
+  {
+    uint32_t s;
+
+    do
+    {
+      s = m_seq.load(std::memory_order_acquire);
+      memcpy(&v, (const void *)&m_buf[(s >> 1) & 1], sizeof(T)); // last complete write
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while(m_seq.load(std::memory_order_relaxed) - (s & ~1UL) >= 3); // that buffer was rewritten
+  }
+
+private:
+  T m_buf[2];
+  std::atomic<uint32_t> m_seq{0};
+};
+
+#endif // SEQLOCK_H
@@ -0,0 +1,30 @@
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+// The plain settings, one line each.  This makes the eeMem fields, the settings snapshot,
+// setJson(), the command names and their range checked apply in Waterbed2.ino.
+// X(type, ee member, default, command, json key, kind, min, max, run after a change)
+
+#define SETTINGS(X) \
+  X(uint16_t, vacaTemp,  700,   "vacatemp", "vt",    SK_TENTHS, (bCF ? 100 : 600), (bCF ? 290 : 840), ) \
+  X(int8_t,   tz,        -5,    "TZ",       "tz",    SK_INT,    -12, 14,    udptime.start()) \
+  X(bool,     bAvg,      true,  "avg",      "avg",   SK_BOOL,   0,   1,     ) \
+  X(bool,     bVaca,     false, "vaca",     "vo",    SK_BOOL,   0,   1,     ) \
+  X(bool,     bEco,      false, "eco",      "e",     SK_BOOL,   0,   1,     setHeat()) \
+  X(uint16_t, ppkwh,     154,   "ppkwh",    "ppkwh", SK_INT,    1,   9999,  ) \
+  X(uint16_t, rate,      50,    "rate",     "r",     SK_INT,    1,   3600,  sendState()) \
+  X(uint16_t, watts,     290,   "watts",    "w",     SK_INT,    1,   2000,  ) \
+  X(bool,     bStaticIP, false, "static",   "sip",   SK_BOOL,   0,   1,     ) \
+  X(uint16_t, bedGates,  0x07,  "bedgates", "bg",    SK_INT,    0,   0x1FF, )
+
+// vacaTemp: degrees x10.  ppkwh: $0.154 / KWH.  rate: seconds between state pushes.  watts: heating pad.
+// bStaticIP: keep the last lease as a static IP.  bedGates: radar gates (0.75m each) covering the bed
+
+enum settingKind
+{
+  SK_INT,
+  SK_BOOL,
+  SK_TENTHS,  // sent as a decimal, kept x10
+};
+
+#endif // SETTINGS_H
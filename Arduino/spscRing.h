@@ -0,0 +1,54 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Single producer, single consumer ring.  push() is only called from one task and pop() from
+// one other, so no lock is needed.  Holds N-1 entries
+template <class T, uint8_t N>
+class SpscRing
+{
+public:
+  SpscRing(){}
+
+  bool push(const T &v) // producer
+  {
+    uint8_t h = m_head.load(std::memory_order_relaxed);
+    uint8_t next = (h + 1) % N;
+
+    if(next == m_tail.load(std::memory_order_acquire)) // full, the newest is dropped
+    {
+      m_drops++;
+      return false;
+    }
+    m_buf[h] = v;
+    m_head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  bool empty(void) // either side
+  {
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+  }
+
+  bool pop(T &v) // consumer
+  {
+    uint8_t t = m_tail.load(std::memory_order_relaxed);
+
+    if(t == m_head.load(std::memory_order_acquire))
+      return false;
+    v = m_buf[t];
+    m_tail.store((t + 1) % N, std::memory_order_release);
+    return true;
+  }
+
+  uint32_t m_drops;
+
+private:
+  T m_buf[N];
+  std::atomic<uint8_t> m_head{0};
+  std::atomic<uint8_t> m_tail{0};
+};
+
+#endif // SPSCRING_H
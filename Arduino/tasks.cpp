@@ -0,0 +1,244 @@
+#include "tasks.h"
+#include "monoTime.h"
+#include "eeMem.h" // for jsonString
+#include "jsonstring.h"
+
+#define TW_MASK (TW_SLOTS - 1)
+
+Tasks::Tasks()
+{
+  memset(m_slot, -1, sizeof(m_slot));
+}
+
+uint32_t Tasks::tickNow()
+{
+  return monoMs() / TW_TICK;
+}
+
+// returns the id, or -1 if the table is full
+int8_t Tasks::add(const char *pName, void (*fn)(void), uint32_t periodMs)
+{
+  if(m_cnt >= TASK_CNT)
+    return -1;
+  if(m_cnt == 0)
+    m_tick = tickNow();
+
+  int8_t id = m_cnt++;
+  task &t = m_task[id];
+  t.pName = pName;
+  t.fn = fn;
+  t.period = (periodMs + TW_TICK - 1) / TW_TICK;
+  t.slot = -1;
+  if(t.period)
+    start(id, periodMs);
+  return id;
+}
+
+void Tasks::start(int8_t id, uint32_t ms)
+{
+  if(id < 0 || id >= m_cnt)
+    return;
+  unlink(id);
+  if(id == m_run)
+    m_bTouched = true;
+
+  uint32_t due = (monoMs() + ms + TW_TICK - 1) / TW_TICK; // never early
+  if((int32_t)(due - m_tick) <= 0) // this tick is already done
+    due = m_tick + 1;
+  m_task[id].due = due;
+  insert(id);
+}
+
+void Tasks::stop(int8_t id)
+{
+  if(id < 0 || id >= m_cnt)
+    return;
+  unlink(id);
+  if(id == m_run)
+    m_bTouched = true;
+}
+
+bool Tasks::active(int8_t id)
+{
+  return (id >= 0 && id < m_cnt && m_task[id].slot >= 0);
+}
+
+uint32_t Tasks::remaining(int8_t id)
+{
+  if(!active(id))
+    return 0;
+  int32_t ticks = m_task[id].due - tickNow();
+  return (ticks > 0) ? ticks * TW_TICK : 0;
+}
+
+// Level 0 holds the next TW_SLOTS ticks, each higher level TW_SLOTS times coarser.
+// Entries are moved down a level as their slot comes up (cascade)
+void Tasks::insert(int8_t id)
+{
+  task &t = m_task[id];
+  uint32_t delta = t.due - m_tick;
+  uint8_t lvl, idx;
+
+  if(delta < TW_SLOTS)
+  {
+    lvl = 0;
+    idx = t.due & TW_MASK;
+  }
+  else if(delta < (1UL << (TW_BITS * 2)))
+  {
+    lvl = 1;
+    idx = (t.due >> TW_BITS) & TW_MASK;
+  }
+  else
+  {
+    lvl = 2;
+    if(delta < (1UL << (TW_BITS * 3)))
+      idx = (t.due >> (TW_BITS * 2)) & TW_MASK;
+    else // past the end of the wheel, placed again when this slot comes around
+      idx = (m_tick >> (TW_BITS * 2)) & TW_MASK;
+  }
+
+  t.slot = lvl * TW_SLOTS + idx;
+  t.next = -1;
+
+  int8_t *p = &m_slot[lvl][idx]; // append keeps tasks due together in the order they were added
+  while(*p >= 0)
+    p = &m_task[*p].next;
+  *p = id;
+}
+
+void Tasks::unlink(int8_t id)
+{
+  task &t = m_task[id];
+  if(t.slot < 0)
+    return;
+
+  int8_t *p = &m_slot[t.slot / TW_SLOTS][t.slot % TW_SLOTS];
+  while(*p >= 0)
+  {
+    if(*p == id)
+    {
+      *p = t.next;
+      break;
+    }
+    p = &m_task[*p].next;
+  }
+  t.slot = -1;
+}
+
+void Tasks::cascade(uint8_t level)
+{
+  uint8_t idx = (m_tick >> (TW_BITS * level)) & TW_MASK;
+  int8_t id = m_slot[level][idx];
+
+  m_slot[level][idx] = -1;
+  while(id >= 0)
+  {
+    int8_t next = m_task[id].next;
+    insert(id);
+    id = next;
+  }
+}
+
+void Tasks::run()
+{
+  uint32_t now = tickNow();
+
+  while((int32_t)(now - m_tick) > 0)
+  {
+    m_tick++;
+    if((m_tick & TW_MASK) == 0)
+    {
+      if(((m_tick >> TW_BITS) & TW_MASK) == 0)
+        cascade(2);
+      cascade(1);
+    }
+
+    int8_t *pHead = &m_slot[0][m_tick & TW_MASK];
+    while(*pHead >= 0)
+    {
+      int8_t id = *pHead;
+      task &t = m_task[id];
+      unlink(id);
+
+      uint32_t late = (now - t.due) * TW_TICK;
+      if(late > t.lateMs)
+        t.lateMs = late;
+
+      m_run = id;
+      m_bTouched = false;
+      uint32_t us = micros();
+      t.fn();
+      us = micros() - us;
+      m_run = -1;
+
+      t.runs++;
+      t.totalUs += us;
+      if(us > t.maxUs)
+        t.maxUs = us;
+
+      if(t.period && !m_bTouched) // not stopped or restarted by itself
+      {
+        t.due += t.period; // no drift
+        if((int32_t)(t.due - now) <= 0) // fell behind, skip the missed ones
+          t.due = now + t.period;
+        insert(id);
+      }
+    }
+  }
+}
+
+// how long loop() can sleep
+uint32_t Tasks::idleMs()
+{
+  uint32_t ms = TASK_POLL;
+
+  for(uint8_t i = 0; i < m_cnt; i++)
+    if(active(i))
+      ms = min(ms, remaining(i));
+  return ms;
+}
+
+void Tasks::idle()
+{
+#ifdef ESP32
+  if(m_loopTask == NULL)
+    m_loopTask = xTaskGetCurrentTaskHandle();
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(idleMs()));
+#else
+  delay(idleMs());
+#endif
+}
+
+void Tasks::wake()
+{
+#ifdef ESP32
+  if(m_loopTask)
+    xTaskNotifyGive(m_loopTask);
+#endif
+}
+
+void IRAM_ATTR Tasks::wakeISR()
+{
+#ifdef ESP32
+  BaseType_t bWoken = pdFALSE;
+
+  if(m_loopTask)
+    vTaskNotifyGiveFromISR(m_loopTask, &bWoken);
+  if(bWoken)
+    portYIELD_FROM_ISR();
+#endif
+}
+
+String Tasks::statsJson()
+{
+  jsonString js;
+
+  for(uint8_t i = 0; i < m_cnt; i++)
+  {
+    task &t = m_task[i];
+    uint32_t a[4] = {t.runs, t.runs ? (uint32_t)(t.totalUs / t.runs) : 0, t.maxUs, t.lateMs};
+    js.Array(t.pName, a, 4); // runs, avg us, max us, max late ms
+  }
+  return js.Close();
+}
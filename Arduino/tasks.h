@@ -0,0 +1,68 @@
+#ifndef TASKS_H
+#define TASKS_H
+
+#include <Arduino.h>
+
+#define TASK_CNT    16   // registered tasks
+#define TW_TICK     10   // ms per wheel tick
+#define TW_BITS     6
+#define TW_SLOTS    (1 << TW_BITS) // per level. 0.64s, 41s, 44min
+#define TW_LEVELS   3
+#ifdef ESP32
+#define TASK_POLL   50   // max ms loop() sleeps, for the libraries that are polled.  wake() ends it sooner
+#else
+#define TASK_POLL   10   // nothing can end a delay() here
+#endif
+
+struct task
+{
+  const char *pName;
+  void (*fn)(void);
+  uint32_t period;    // ticks, 0 = one shot
+  uint32_t due;       // tick
+  int8_t   next;      // next in the slot, -1 = end
+  int16_t  slot;      // level * TW_SLOTS + index, -1 = not armed
+  uint32_t runs;
+  uint64_t totalUs;
+  uint32_t maxUs;
+  uint32_t lateMs;    // worst start delay
+};
+
+// Cooperative tasks on a hierarchical timer wheel.  A task runs from loop() when its period or
+// deadline comes up, so nothing counts down by hand and idle passes cost nothing.  Between them
+// loop() sleeps in idle(), and queues filled by other tasks or interrupts wake it.
+class Tasks
+{
+public:
+  Tasks();
+  int8_t add(const char *pName, void (*fn)(void), uint32_t periodMs = 0); // 0 = one shot, use start()
+  void start(int8_t id, uint32_t ms);   // (re)arm to run in ms, a periodic task then keeps its period
+  void stop(int8_t id);
+  bool active(int8_t id);
+  uint32_t remaining(int8_t id);        // ms
+  void run(void);                       // call from loop()
+  uint32_t idleMs(void);                // ms until the next task is due, up to TASK_POLL
+  void idle(void);                      // loop() sleeps that long, or until wake()
+  void wake(void);                      // from another task, something for loop() was queued
+  void wakeISR(void);
+  String statsJson(void);
+private:
+  uint32_t tickNow(void);
+  void insert(int8_t id);
+  void unlink(int8_t id);
+  void cascade(uint8_t level);
+
+  task     m_task[TASK_CNT];
+  int8_t   m_slot[TW_LEVELS][TW_SLOTS]; // list heads
+  uint8_t  m_cnt;
+  uint32_t m_tick;    // last tick processed
+  int8_t   m_run = -1; // task running now
+  bool     m_bTouched; // it was started or stopped while running
+#ifdef ESP32
+  TaskHandle_t m_loopTask;
+#endif
+};
+
+extern Tasks tasks;
+
+#endif // TASKS_H
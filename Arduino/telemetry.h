@@ -0,0 +1,142 @@
+// Room sensor telemetry sent by UDP to the HVAC controller
+// Shared by the sender and receiver.  Plain C++ so it also builds on a PC
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define TELEM_PORT    8266
+#define TELEM_VER     1
+#define TELEM_IDS     4   // sensors tracked by a receiver
+
+#define TF_CELSIUS  1
+#define TF_SIGNED   2   // mac is valid
+
+// little endian, as sent
+struct telemPacket
+{
+  uint32_t id;      // sensor ID
+  uint32_t seq;     // always increases, the sender starts at the clock time and waits until it's set
+  int16_t  temp;    // x10
+  uint16_t rh;      // x10
+  uint8_t  flags;
+  uint8_t  ver;
+  uint16_t res;
+  uint8_t  mac[8];  // SipHash-2-4 of the fields above
+};
+
+static inline uint64_t sipRotl(uint64_t x, uint8_t b)
+{
+  return (x << b) | (x >> (64 - b));
+}
+
+static inline void sipRound(uint64_t v[4])
+{
+  v[0] += v[1]; v[1] = sipRotl(v[1], 13); v[1] ^= v[0]; v[0] = sipRotl(v[0], 32);
+  v[2] += v[3]; v[3] = sipRotl(v[3], 16); v[3] ^= v[2];
+  v[0] += v[3]; v[3] = sipRotl(v[3], 21); v[3] ^= v[0];
+  v[2] += v[1]; v[1] = sipRotl(v[1], 17); v[1] ^= v[2]; v[2] = sipRotl(v[2], 32);
+}
+
+// SipHash-2-4 keyed hash (16 byte key), little endian only
+static inline uint64_t sipHash(const uint8_t *key, const uint8_t *p, uint8_t len)
+{
+  uint64_t k0, k1, m;
+  memcpy(&k0, key, 8);
+  memcpy(&k1, key + 8, 8);
+  uint64_t v[4] = {k0 ^ 0x736f6d6570736575ULL, k1 ^ 0x646f72616e646f6dULL,
+                   k0 ^ 0x6c7967656e657261ULL, k1 ^ 0x7465646279746573ULL};
+  uint8_t i;
+
+  for(i = 0; i + 8 <= len; i += 8)
+  {
+    memcpy(&m, p + i, 8);
+    v[3] ^= m;
+    sipRound(v); sipRound(v);
+    v[0] ^= m;
+  }
+  m = (uint64_t)len << 56;
+  for(uint8_t j = 0; i + j < len; j++)
+    m |= (uint64_t)p[i + j] << (j * 8);
+  v[3] ^= m;
+  sipRound(v); sipRound(v);
+  v[0] ^= m;
+  v[2] ^= 0xFF;
+  sipRound(v); sipRound(v); sipRound(v); sipRound(v);
+  return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+static inline void telemSign(telemPacket &pkt, const uint8_t *key)
+{
+  pkt.flags |= TF_SIGNED;
+  uint64_t h = sipHash(key, (uint8_t *)&pkt, offsetof(telemPacket, mac));
+  memcpy(pkt.mac, &h, sizeof(pkt.mac));
+}
+
+// Receiver side.  With a key, unsigned, forged and replayed packets are dropped.
+// The last seq of each sensor is only kept in RAM, so restarting the receiver accepts the next
+// packet of each.  With more sensors than TELEM_IDS the one heard from longest ago is forgotten.
+// tools/telemReceiver.cpp tests this on a PC
+class TelemReceiver
+{
+public:
+  TelemReceiver(const uint8_t *key = NULL)
+  {
+    m_pKey = key;
+    m_heard = 0;
+    memset(m_bUsed, 0, sizeof(m_bUsed));
+    memset(m_id, 0, sizeof(m_id));
+    memset(m_seq, 0, sizeof(m_seq));
+    memset(m_last, 0, sizeof(m_last));
+  }
+
+  bool parse(const uint8_t *buf, int len, telemPacket &pkt)
+  {
+    if(len != sizeof(telemPacket))
+      return false;
+    memcpy(&pkt, buf, sizeof(pkt));
+    if(pkt.ver != TELEM_VER)
+      return false;
+    if(m_pKey == NULL)
+      return true;
+
+    if(!(pkt.flags & TF_SIGNED))
+      return false;
+    uint64_t h = sipHash(m_pKey, buf, offsetof(telemPacket, mac));
+    if(memcmp(&h, pkt.mac, sizeof(pkt.mac)))
+      return false;
+
+    uint8_t i, slot = 0;
+    for(i = 0; i < TELEM_IDS; i++)
+    {
+      if(m_bUsed[i] && m_id[i] == pkt.id)
+        break;
+      if(m_bUsed[slot] && (!m_bUsed[i] || (int32_t)(m_last[i] - m_last[slot]) < 0)) // free, or heard from longest ago
+        slot = i;
+    }
+    if(i == TELEM_IDS) // new sensor
+    {
+      i = slot;
+      m_bUsed[i] = true;
+      m_id[i] = pkt.id;
+    }
+    else if(pkt.seq <= m_seq[i]) // replayed
+      return false;
+    m_seq[i] = pkt.seq;
+    m_last[i] = ++m_heard;
+    return true;
+  }
+
+private:
+  const uint8_t *m_pKey;
+  uint32_t m_heard;            // good packets, orders the senders by when they were last heard
+  bool     m_bUsed[TELEM_IDS];
+  uint32_t m_id[TELEM_IDS];
+  uint32_t m_seq[TELEM_IDS];
+  uint32_t m_last[TELEM_IDS];
+};
+
+#endif // TELEMETRY_H
@@ -1,14 +1,18 @@
 #include "display.h"
 #include "tempArray.h"
 #include "eeMem.h"
+#include "schedule.h"
 #include "jsonstring.h"
 #include "Nextion.h"
+#include "respCache.h"
 #include <TimeLib.h>
 
 extern Nextion nex;
 
 void TempArray::add()
 {
+  respCache.changed(RC_HIST);
+
   int iPos = hour() << 2; // 4 per hour
   if( minute() ) // force 1 and 3 slots
   {
@@ -101,29 +105,31 @@ uint16_t TempArray::tween(uint16_t t1, uint16_t t2, int m, int r)
 
 void TempArray::draw()
 {
+  uint8_t cnt = sched.dayCnt();
+
   mn = 1000; // get range
   mx = 0;
-  for(uint8_t i = 0; i < ee.schedCnt[display.m_season]; i++)
+  for(uint8_t i = 0; i < cnt; i++)
   {
-    if(mn > ee.schedule[display.m_season][i].setTemp) mn = ee.schedule[display.m_season][i].setTemp;
-    if(mx < ee.schedule[display.m_season][i].setTemp) mx = ee.schedule[display.m_season][i].setTemp;
+    if(mn > sched.day(i).setTemp) mn = sched.day(i).setTemp;
+    if(mx < sched.day(i).setTemp) mx = sched.day(i).setTemp;
   }
   mn /= 10; mn *= 10; // floor
   mx += (10-(mx%10)); // ciel
   nex.itemText(25, String(mx / 10) );
   nex.itemText(26, String(mn / 10) );
 
-  uint16_t m = Sch_Width - tm2x(ee.schedule[ee.schedCnt[display.m_season]-1][0].timeSch); // wrap line
-  uint16_t r = m + tm2x(ee.schedule[display.m_season][0].timeSch);
-  uint16_t ttl = tween(ee.schedule[display.m_season][ee.schedCnt[display.m_season]-1].setTemp, ee.schedule[display.m_season][0].setTemp, m, r); // get y of midnight
+  uint16_t m = Sch_Width - tm2x(sched.day(cnt-1).timeSch); // wrap line
+  uint16_t r = m + tm2x(sched.day(0).timeSch);
+  uint16_t ttl = tween(sched.day(cnt-1).setTemp, sched.day(0).setTemp, m, r); // get y of midnight
 
   uint16_t x = Sch_Left, x2;
   uint16_t y = t2y(ttl) + Sch_Top, y2;
 
-  for(uint8_t i = 0; i < ee.schedCnt[display.m_season]; i++)
+  for(uint8_t i = 0; i < cnt; i++)
   {
-    x2 = tm2x(ee.schedule[display.m_season][i].timeSch) + Sch_Left;
-    y2 = t2y(ee.schedule[display.m_season][i].setTemp) + Sch_Top;
+    x2 = tm2x(sched.day(i).timeSch) + Sch_Left;
+    y2 = t2y(sched.day(i).setTemp) + Sch_Top;
     nex.line(x, y, x2, y2, rgb16(31, 31, 0) );
     delay(1);
     x = x2;
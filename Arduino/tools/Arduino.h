@@ -0,0 +1,16 @@
+// Just enough of Arduino.h to build parts of the sketch on a PC for the tools here
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+uint64_t micros64(void); // the tool that builds monoTime.cpp defines it
+
+#endif // ARDUINO_H
@@ -0,0 +1,9 @@
+// Ticker is only a member of Music here, the tools never start it
+#ifndef TICKER_H
+#define TICKER_H
+
+class Ticker
+{
+};
+
+#endif // TICKER_H
@@ -0,0 +1,123 @@
+// Checks the alarm times on a PC: Alarms::nextFire() over a day and a week rollover, weekday
+// bits and unused entries, then check() and service() as loop() calls them, with DST moving
+// the local clock forward over an alarm and back over one that already rang.
+//
+// Build from the Arduino folder:
+//   g++ -O2 -Itools -I. tools/alarmFire.cpp alarms.cpp -o alarmFire
+// Run:
+//   alarmFire     (prints each check, exits 1 if any fail)
+
+#include <stdio.h>
+#include <time.h>
+#include "alarms.h"
+#include "music.h"
+
+eeMem ee;
+Music mus;
+static uint32_t beeps;
+
+bool Music::add(uint16_t note, uint16_t delay, bool bNow)
+{
+  if(note)
+    beeps++;
+  return true;
+}
+
+bool Music::play(int song)
+{
+  beeps++;
+  return true;
+}
+
+static int fails;
+
+static void check(const char *pName, long got, long want)
+{
+  printf("%-44s %10ld %s\n", pName, got, (got == want) ? "ok" : "FAIL");
+  if(got != want)
+    fails++;
+}
+
+static const time_t DAY = 24 * 60 * 60;
+
+int main()
+{
+  const time_t mon = 4 * DAY + 7 * 7 * DAY; // a Monday midnight, 1/1/1970 was a Thursday
+  Alarm a[3];
+  int8_t idx;
+
+  memset(a, 0, sizeof(a));
+  a[0].timeSch = 8 * 60;
+  a[0].wday = 0x7F; // every day
+
+  check("before today's", Alarms::nextFire(a, 1, mon + 7 * 3600, &idx), mon + 8 * 3600);
+  check("at the minute, tomorrow", Alarms::nextFire(a, 1, mon + 8 * 3600, &idx), mon + DAY + 8 * 3600);
+  check("late evening, over midnight", Alarms::nextFire(a, 1, mon + 23 * 3600 + 59 * 60, &idx), mon + DAY + 8 * 3600);
+
+  a[0].wday = 1 << 1; // Mondays
+  check("Monday only, from Monday 09:00", Alarms::nextFire(a, 1, mon + 9 * 3600, &idx), mon + 7 * DAY + 8 * 3600);
+  a[0].wday = 1 << 0; // Sundays
+  a[0].timeSch = 30;
+  check("Sunday 00:30 from Saturday 23:30", Alarms::nextFire(a, 1, mon + 5 * DAY + 23 * 3600 + 30 * 60, &idx),
+    mon + 6 * DAY + 30 * 60);
+
+  a[0].wday = 0;
+  check("no days, none", Alarms::nextFire(a, 1, mon, &idx), 0);
+  check("none, index", idx, -1);
+
+  a[0].wday = 0x7F;
+  a[0].timeSch = 24 * 60; // not a time
+  a[1].wday = 0x3E; // weekdays
+  a[1].timeSch = 6 * 60 + 30;
+  a[2].wday = 0x7F;
+  a[2].timeSch = 7 * 60;
+  check("earliest of several", Alarms::nextFire(a, 3, mon, &idx), mon + 6 * 3600 + 30 * 60);
+  check("earliest, index", idx, 1);
+  check("Friday night to Saturday", Alarms::nextFire(a, 3, mon + 4 * DAY + 22 * 3600, &idx), mon + 5 * DAY + 7 * 3600);
+  check("Saturday, index", idx, 2);
+
+  // check() as loop() calls it once a second, local time
+  Alarms al;
+
+  memset(ee.alarm, 0, sizeof(ee.alarm));
+  ee.alarm[0].timeSch = 2 * 60 + 30; // 02:30, inside the DST hour
+  ee.alarm[0].wday = 0x7F;
+
+  time_t t = mon + 1 * 3600 + 59 * 60;
+  al.update(t);
+  check("next is 02:30", al.next(), mon + 2 * 3600 + 30 * 60);
+  t = mon + 3 * 3600; // DST forward, 02:00 is 03:00
+  check("clock stepped over it, still rings", al.check(t, true), 1);
+  check("next is tomorrow", al.next(), mon + DAY + 2 * 3600 + 30 * 60);
+  al.stop();
+
+  t = mon + DAY + 2 * 3600 + 30 * 60;
+  check("rings on time", al.check(t, true), 1);
+  al.stop();
+  t -= 30 * 60 - 60; // DST back, 02:31 is 02:01 again
+  al.update(t);
+  check("repeated hour doesn't ring again", al.check(t + 30 * 60, true), 0);
+  check("next is the day after", al.next(), mon + 2 * DAY + 2 * 3600 + 30 * 60);
+
+  t = mon + 2 * DAY + 2 * 3600 + 30 * 60 + 2 * 3600; // off for two hours
+  check("too late, skipped", al.check(t, true), 0);
+  check("skipped, next", al.next(), mon + 3 * DAY + 2 * 3600 + 30 * 60);
+
+  t = al.next();
+  check("disabled doesn't ring", al.check(t, false), 0);
+
+  t = al.next();
+  check("rings", al.check(t, true), 1);
+  al.snooze(t + 10);
+  check("snoozed", al.next(), t + 10 + SNOOZE_TIME);
+  check("snooze rings", al.check(t + 10 + SNOOZE_TIME, true), 1);
+
+  beeps = 0;
+  for(int s = 0; s < 200 && al.active(); s++)
+    al.service();
+  check("unanswered alarm stops", al.active(), 0);
+  check("beeps in the stages", beeps, 15 + 30 + 30 * 2 + 4 * 3);
+
+  printf("%s\n", fails ? "FAILED" : "all passed");
+  return fails ? 1 : 0;
+}
@@ -0,0 +1,86 @@
+// Checks WallClock on a PC by feeding tick() wall clock and monotonic times with steps in them,
+// as clockTask() gets them: NTP corrections, the first set, steps forward over half hours and
+// hours, and DST going back.  Each case lists the flags tick() has to return.
+//
+// Build from the Arduino folder:
+//   g++ -O2 -Itools -I. tools/clockSteps.cpp monoTime.cpp -o clockSteps
+// Run:
+//   clockSteps     (prints each check, exits 1 if any fail)
+
+#include <stdio.h>
+#include "monoTime.h"
+
+uint64_t micros64(){ return 0; } // monoMs() isn't used here
+
+static int fails;
+static WallClock clk;
+static uint64_t ms;  // monotonic
+static time_t t;     // wall
+
+static uint8_t run(uint32_t secs) // ticks once a second, the flags of all of them
+{
+  uint8_t flags = 0;
+
+  for(uint32_t i = 0; i < secs; i++)
+  {
+    t++;
+    ms += 1000;
+    flags |= clk.tick(t, ms);
+  }
+  return flags;
+}
+
+static void check(const char *pName, uint8_t got, uint8_t want)
+{
+  printf("%-40s %02X %s\n", pName, got, (got == want) ? "ok" : "FAIL");
+  if(got != want)
+    fails++;
+}
+
+int main()
+{
+  const time_t day = 1700006400 - (1700006400 % 86400); // midnight
+
+  t = 10; // boot, no time yet
+  ms = 5000;
+  clk.tick(t, ms);
+  run(5);
+
+  t = day + 10 * 3600 + 20 * 60 + 5; // NTP, 10:20:05
+  check("first set", clk.tick(t, ms), WC_JUMP | WC_MINUTE);
+  check("same minute", run(50), 0);
+  check("next minute", run(10), WC_MINUTE);
+
+  t += 1; // small NTP correction
+  check("1s correction", run(1), 0);
+  t -= 1;
+  check("1s back", run(1), 0);
+
+  check("to 10:30", run(9 * 60), WC_MINUTE | WC_HALF);
+  check("to 11:00", run(30 * 60), WC_MINUTE | WC_HALF | WC_HOUR);
+
+  t += 20 * 60; // 11:00 + 20 minutes, no boundary
+  check("step 20 min inside the half hour", clk.tick(t, ms), WC_JUMP | WC_MINUTE);
+
+  t += 15 * 60; // over 11:30
+  check("step over the half hour", clk.tick(t, ms), WC_JUMP | WC_MINUTE | WC_HALF);
+
+  t += 40 * 60; // over 12:00
+  check("step over the hour", clk.tick(t, ms), WC_JUMP | WC_MINUTE | WC_HALF | WC_HOUR);
+
+  t += 3 * 3600; // several hours
+  check("step over hours", clk.tick(t, ms), WC_JUMP | WC_MINUTE | WC_HALF | WC_HOUR);
+
+  t -= 60; // a minute back, already done
+  check("1 min back, not repeated", clk.tick(t, ms), WC_JUMP);
+  check("caught up, then the next minute", run(121), WC_MINUTE);
+
+  t = t - (t % 3600) + 3600 - 5; // 5s before the hour
+  clk.tick(t, ms);
+  check("hour", run(10), WC_MINUTE | WC_HALF | WC_HOUR);
+  t -= 3600; // DST back an hour
+  check("DST back, hour runs again", clk.tick(t, ms), WC_JUMP | WC_MINUTE | WC_HALF | WC_HOUR);
+
+  printf("%s\n", fails ? "FAILED" : "all passed");
+  return fails ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+// Replays radar captures through the same occupancy classifier and presence model as the
+// firmware, as fast as the PC goes, and reports each class change with how long the decision
+// took, and each presence event with the calls presenceEvent() makes for it.
+//
+// Capture a night: connect to ws://[esp ip]/ws, send {"sub":"radarcap"} and keep each message
+// as a line, e.g.  (echo '{"sub":"radarcap"}'; cat) | websocat ws://192.168.31.x/ws > night.cap
+//
+// Build from the Arduino folder:
+//   g++ -O2 -Itools -I. tools/radarReplay.cpp ldFrame.cpp occupancy.cpp presence.cpp -o radarReplay
+// Run:
+//   radarReplay [-g bedGates] [-q] night.cap [more.cap ...]
+//   -g  bed gate bits as in the bedgates command, default 7
+//   -q  only the totals
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "occupancy.h"
+#include "presence.h"
+
+Occupancy occ;
+Presence presence;
+
+struct replayTotals
+{
+  uint32_t frames;
+  uint32_t ms[OCC_CNT];     // time spent in each class
+  uint32_t changes;
+  uint32_t events[PE_CNT];
+  uint32_t lightCalls;
+  uint32_t fanCalls;
+  uint32_t latSum;
+  uint32_t latMax;
+};
+
+static const char *evName[] = {"", "arrive", "leave", "in bed", "out of bed"};
+
+// what presenceEvent() in Waterbed2.ino does for each event, from the same prAction table
+static const char *evCalls(uint8_t ev, replayTotals &t)
+{
+  static const char *name[] = {"sendState", "screen", "LightSwitch(0,1)", "LightSwitch(0,0)",
+    "light off in 5s", "light timer off", "FanSwitch(1)", "FanSwitch(0)"};
+  static char s[200];
+  uint16_t f = prAction[ev].flags;
+
+  s[0] = 0;
+  for(uint8_t i = 0; i < sizeof(name) / sizeof(name[0]); i++)
+    if(f & (1 << i))
+    {
+      if(s[0])
+        strcat(s, ", ");
+      strcat(s, name[i]);
+    }
+  if(prAction[ev].chimeMs)
+    strcat(s, ", chime");
+  if(f & (PA_LIGHT_ON | PA_LIGHT_OFF))
+    t.lightCalls++;
+  if(f & (PA_FAN_ON | PA_FAN_OFF))
+    t.fanCalls++;
+  return s;
+}
+
+static bool parseCap(char *pLine, radarSample &r) // {"cmd":"rcap","f":[ms,state,det,movD,movE,statD,statE,gates,mov[9],stat[9]]}
+{
+  if(strstr(pLine, "\"rcap\"") == NULL)
+    return false;
+  char *p = strchr(pLine, '[');
+  if(p == NULL)
+    return false;
+
+  uint32_t a[8 + LD_GATES * 2];
+  for(int i = 0; i < 8 + LD_GATES * 2; i++)
+  {
+    char *pEnd;
+    a[i] = strtoul(p + 1, &pEnd, 10);
+    if(pEnd == p + 1)
+      return false;
+    p = pEnd;
+  }
+
+  r.ms = a[0];
+  r.bMoving = (a[1] & LD_MOVING) ? true : false;
+  r.bStationary = (a[1] & LD_STATIONARY) ? true : false;
+  r.bPresence = (a[1] != LD_NONE);
+  r.detDist = a[2];
+  r.movDist = a[3];
+  r.movEnergy = a[4];
+  r.statDist = a[5];
+  r.statEnergy = a[6];
+  r.gates = a[7];
+  for(int g = 0; g < LD_GATES; g++)
+  {
+    r.movGate[g] = a[8 + g];
+    r.statGate[g] = a[8 + LD_GATES + g];
+  }
+  return true;
+}
+
+static void replay(FILE *fp, uint16_t bedGates, bool bQuiet, replayTotals &t)
+{
+  char szLine[512];
+  radarSample r;
+  uint32_t startMs = 0;
+  uint32_t lastMs = 0;
+  uint8_t cls = occ.cls();
+  bool bFirst = true;
+
+  while(fgets(szLine, sizeof(szLine), fp))
+  {
+    if(!parseCap(szLine, r))
+      continue;
+    t.frames++;
+    if(bFirst)
+      startMs = lastMs = r.ms;
+    bFirst = false;
+
+    t.ms[cls] += r.ms - lastMs;
+    lastMs = r.ms;
+
+    uint32_t s = (r.ms - startMs) / 1000;
+
+    if(occ.add(r, bedGates))
+    {
+      cls = occ.cls();
+      uint32_t lat = occ.latency();
+      t.changes++;
+      t.latSum += lat;
+      if(lat > t.latMax)
+        t.latMax = lat;
+      if(!bQuiet)
+        printf("%2u:%02u:%02u  %-8s %3u%%  %5.1fs\n", s / 3600, (s / 60) % 60, s % 60,
+          occ.name(cls), occ.confidence(), lat / 1000.0);
+    }
+
+    presence.radar(occ.cls(), r.ms);
+    bool bInBed = presence.inBed();
+    uint8_t ev = presence.update(r.ms);
+    if(ev == PE_NONE)
+      continue;
+    t.events[ev]++;
+    const char *pCalls = evCalls(ev, t);
+    if(!bQuiet)
+      printf("%2u:%02u:%02u  > %-10s %s%s\n", s / 3600, (s / 60) % 60, s % 60, evName[ev], pCalls,
+        presence.inBed() == bInBed ? "" : bInBed ? ", inBed 0" : ", inBed 1");
+  }
+}
+
+int main(int argc, char **argv)
+{
+  uint16_t bedGates = 7;
+  bool bQuiet = false;
+  replayTotals t;
+  int nFiles = 0;
+  static const Occupancy blank; // zeroed, as the firmware's globals start
+  static const Presence blankPres;
+
+  memset(&t, 0, sizeof(t));
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(!strcmp(argv[i], "-g") && i + 1 < argc)
+      bedGates = strtoul(argv[++i], NULL, 0) & 0x1FF;
+    else if(!strcmp(argv[i], "-q"))
+      bQuiet = true;
+    else
+    {
+      FILE *fp = fopen(argv[i], "r");
+      if(fp == NULL)
+      {
+        fprintf(stderr, "can't open %s\n", argv[i]);
+        return 1;
+      }
+      if(!bQuiet)
+        printf("%s\n", argv[i]);
+      occ = blank; // each night starts empty
+      presence = blankPres;
+      replay(fp, bedGates, bQuiet, t);
+      fclose(fp);
+      nFiles++;
+    }
+  }
+
+  if(nFiles == 0)
+  {
+    fprintf(stderr, "usage: radarReplay [-g bedGates] [-q] capture [...]\n");
+    return 1;
+  }
+
+  printf("frames %u  class changes %u  arrive %u  leave %u  in bed %u  out of bed %u\n", t.frames, t.changes,
+    t.events[PE_ARRIVE], t.events[PE_LEAVE], t.events[PE_IN_BED], t.events[PE_OUT_BED]);
+  printf("LightSwitch %u  FanSwitch %u\n", t.lightCalls, t.fanCalls);
+  printf("latency avg %.1fs max %.1fs\n", t.changes ? t.latSum / 1000.0 / t.changes : 0, t.latMax / 1000.0);
+  for(uint8_t c = 0; c < OCC_CNT; c++)
+    printf("%-8s %6.1f min\n", occ.name(c), t.ms[c] / 60000.0);
+  return 0;
+}
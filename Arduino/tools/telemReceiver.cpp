@@ -0,0 +1,97 @@
+// Checks telemetry.h on a PC: the SipHash reference vector, then signed packets through
+// TelemReceiver as the HVAC would get them.  Good, altered, unsigned, wrong key, replayed
+// and out of order packets, a sender restart, and more senders than the table holds.
+//
+// Build from the Arduino folder:
+//   g++ -O2 -Itools -I. tools/telemReceiver.cpp -o telemReceiver
+// Run:
+//   telemReceiver     (prints each check, exits 1 if any fail)
+
+#include <stdio.h>
+#include "telemetry.h"
+
+static const uint8_t key[16] = {'0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F'};
+static int fails;
+
+static void check(const char *pName, bool bGot, bool bWant)
+{
+  printf("%-34s %s\n", pName, (bGot == bWant) ? "ok" : "FAIL");
+  if(bGot != bWant)
+    fails++;
+}
+
+static telemPacket packet(uint32_t id, uint32_t seq, const uint8_t *pKey)
+{
+  telemPacket pkt;
+
+  memset(&pkt, 0, sizeof(pkt));
+  pkt.id = id;
+  pkt.seq = seq;
+  pkt.temp = 721;
+  pkt.rh = 455;
+  pkt.ver = TELEM_VER;
+  if(pKey)
+    telemSign(pkt, pKey);
+  return pkt;
+}
+
+static bool send(TelemReceiver &rx, const telemPacket &pkt)
+{
+  telemPacket out;
+  return rx.parse((const uint8_t *)&pkt, sizeof(pkt), out);
+}
+
+int main()
+{
+  // SipHash-2-4 paper: key 00..0f, message 00..0e
+  uint8_t k[16], m[15];
+  for(uint8_t i = 0; i < 16; i++)
+    k[i] = i;
+  for(uint8_t i = 0; i < 15; i++)
+    m[i] = i;
+  check("reference vector", sipHash(k, m, 15) == 0xa129ca6149be45e5ULL, true);
+
+  TelemReceiver rx(key);
+  const uint32_t t = 1700000000;
+
+  check("signed", send(rx, packet(1, t, key)), true);
+  check("next seq", send(rx, packet(1, t + 1, key)), true);
+  check("replayed", send(rx, packet(1, t + 1, key)), false);
+  check("older seq", send(rx, packet(1, t, key)), false);
+
+  telemPacket pkt = packet(1, t + 2, key);
+  pkt.temp = 900;
+  check("altered after signing", send(rx, pkt), false);
+  check("unsigned", send(rx, packet(1, t + 3, NULL)), false);
+
+  static const uint8_t key2[16] = {'x'};
+  check("other key", send(rx, packet(1, t + 4, key2)), false);
+
+  pkt = packet(1, t + 5, key);
+  pkt.ver = TELEM_VER + 1;
+  check("other version", send(rx, pkt), false);
+  check("short", rx.parse((const uint8_t *)&pkt, sizeof(pkt) - 1, pkt), false);
+
+  check("second sensor", send(rx, packet(2, 100, key)), true);
+  check("first sensor still tracked", send(rx, packet(1, t + 1, key)), false);
+  check("sender restart, clock seq", send(rx, packet(1, t + 60, key)), true);
+
+  TelemReceiver rx2(key); // id 0 is a sensor like any other
+  check("id 0", send(rx2, packet(0, 10, key)), true);
+  check("id 0 replayed", send(rx2, packet(0, 10, key)), false);
+
+  for(uint32_t id = 1; id < TELEM_IDS; id++) // fill the table, 0 is heard from longest ago
+    send(rx2, packet(id, 1000, key));
+  check("id 0 heard again", send(rx2, packet(0, 11, key)), true);
+  check("one more sensor", send(rx2, packet(TELEM_IDS, 5, key)), true); // forgets id 1
+  check("id 0 still tracked", send(rx2, packet(0, 11, key)), false);
+  check("restarted sensor, low seq", send(rx2, packet(TELEM_IDS + 1, 1, key)), true); // forgets id 2
+  check("and again, still tracked", send(rx2, packet(TELEM_IDS + 1, 1, key)), false);
+  check("least recent was forgotten", send(rx2, packet(1, 1000, key)), true);
+
+  TelemReceiver open;
+  check("no key takes unsigned", send(open, packet(3, 1, NULL)), true);
+
+  printf("%s\n", fails ? "FAILED" : "all passed");
+  return fails ? 1 : 0;
+}
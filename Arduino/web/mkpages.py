@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+# Builds ../pages.h from the files here.  Run it after editing index.htm or favicon.ico:
+#   python3 web/mkpages.py
+# Pages are minified, local <script src> files are inlined, then everything is gzipped and
+# written as PROGMEM arrays with an ETag from the content hash.
+
+import gzip
+import hashlib
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+OUT = os.path.join(HERE, '..', 'pages.h')
+
+ASSETS = [  # file, array name, minify
+    ('index.htm', 'index_page', True),
+    ('favicon.ico', 'favicon', False),
+]
+
+
+def inline_scripts(html):
+    def repl(m):
+        path = os.path.join(HERE, m.group(1))
+        if not os.path.exists(path):
+            raise SystemExit('missing ' + m.group(1) + ', only local scripts can be inlined')
+        with open(path) as f:
+            return '<script>\n' + f.read() + '\n</script>'
+    return re.sub(r'<script[^>]*\bsrc="([^":]+)"[^>]*>\s*</script>', repl, html)
+
+
+def minify_css(m):
+    css = re.sub(r'/\*.*?\*/', '', m.group(2), flags=re.S)
+    css = re.sub(r'\s+', ' ', css)
+    css = re.sub(r'\s*([{};:,])\s*', r'\1', css)
+    return m.group(1) + css.strip() + m.group(3)
+
+
+def minify(html):
+    html = re.sub(r'(<style[^>]*>)(.*?)(</style>)', minify_css, html, flags=re.S)
+    # Line based, the scripts lean on line ends in place of semicolons
+    out = []
+    for line in html.split('\n'):
+        line = line.strip()
+        if not line or line.startswith('//'):
+            continue
+        out.append(line)
+    return '\n'.join(out)
+
+
+def main():
+    lines = ['// Generated by web/mkpages.py from the files in web/, edit those and run it again', '']
+    for name, array, bMin in ASSETS:
+        with open(os.path.join(HERE, name), 'rb') as f:
+            data = f.read()
+        size = len(data)
+        if bMin:
+            data = minify(inline_scripts(data.decode())).encode()
+        gz = gzip.compress(data, 9, mtime=0)
+        etag = hashlib.sha1(gz).hexdigest()[:8]
+
+        lines.append('// %s %u bytes, %u minified, %u gzipped' % (name, size, len(data), len(gz)))
+        lines.append('#define %s_ETAG "\\"%s\\""' % (array.upper(), etag))
+        lines.append('const uint8_t %s[] PROGMEM = {' % array)
+        for i in range(0, len(gz), 16):
+            lines.append('  ' + ' '.join('0x%02X,' % b for b in gz[i:i + 16]))
+        lines.append('};')
+        lines.append('')
+        print('%-12s %6u -> %6u -> %6u  %s' % (name, size, len(data), len(gz), etag))
+
+    with open(OUT, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
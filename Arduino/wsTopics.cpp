@@ -0,0 +1,198 @@
+#include "wsTopics.h"
+#include "eeMem.h" // for jsonString
+#include "jsonstring.h"
+
+static const char *topicName[] = {"state", "set", "hist", "radar", "alert", "debug", "event", "radarcap"};
+
+WsTopics::WsTopics(AsyncWebSocket *pWs)
+{
+  m_pWs = pWs;
+}
+
+wsSub *WsTopics::find(uint32_t id)
+{
+  for(uint8_t i = 0; i < WST_CLIENTS; i++)
+    if(m_sub[i].id == id)
+      return &m_sub[i];
+  return NULL;
+}
+
+// everything until the client asks for less
+void WsTopics::connect(uint32_t id)
+{
+  wsSub *p = find(0);
+  if(p == NULL)
+  {
+    sweep();
+    p = find(0);
+  }
+  if(p == NULL)
+  {
+    m_full++;
+    jsonString js("alert");
+    js.Var("data", "Too many clients, no updates for this one");
+    m_pWs->text(id, js.Close());
+    return;
+  }
+  memset(p, 0, sizeof(wsSub));
+  p->id = id;
+  p->mask = TP_DEF;
+}
+
+void WsTopics::disconnect(uint32_t id)
+{
+  wsSub *p = find(id);
+  if(p)
+    p->id = 0;
+}
+
+uint8_t WsTopics::subscribe(uint32_t id, char *pList)
+{
+  wsSub *p = find(id);
+  if(p == NULL) // its connect didn't get a slot
+  {
+    connect(id);
+    if((p = find(id)) == NULL)
+      return 0;
+  }
+
+  uint8_t mask = 0;
+  uint32_t ms[TP_CNT] = {0};
+  uint16_t res[TP_CNT] = {0};
+
+  for(char *pTok = strtok(pList, ","); pTok; pTok = strtok(NULL, ","))
+  {
+    char *pMs = strchr(pTok, ':');
+    char *pRes = NULL;
+    if(pMs)
+    {
+      *pMs++ = 0;
+      if((pRes = strchr(pMs, ':')) != NULL)
+        *pRes++ = 0;
+    }
+    for(uint8_t t = 0; t < TP_CNT; t++)
+      if(!strcmp(pTok, topicName[t]))
+      {
+        mask |= 1 << t;
+        ms[t] = pMs ? atol(pMs) : 0;
+        res[t] = pRes ? constrain(atol(pRes), 0, 0xFFFF) : 0;
+      }
+  }
+
+  uint8_t added = mask & ~p->mask;
+  p->mask = mask;
+  p->pending &= mask;
+  p->bSent &= mask;
+  memcpy(p->ms, ms, sizeof(ms));
+  memcpy(p->res, res, sizeof(res));
+  return added;
+}
+
+bool WsTopics::wanted(uint8_t topic)
+{
+  for(uint8_t i = 0; i < WST_CLIENTS; i++)
+    if(m_sub[i].id && (m_sub[i].mask & (1 << topic)))
+      return true;
+  return false;
+}
+
+void WsTopics::publish(uint8_t topic, String s, bool bEvent, int32_t v, uint32_t key)
+{
+  uint8_t bit = 1 << topic;
+  uint32_t ms = millis();
+
+  m_built[topic]++;
+  if(!bEvent)
+  {
+    m_last[topic] = s;
+    m_lastV[topic] = v;
+    m_lastKey[topic] = key;
+  }
+
+  for(uint8_t i = 0; i < WST_CLIENTS; i++)
+  {
+    wsSub &c = m_sub[i];
+    if(c.id == 0 || !(c.mask & bit))
+      continue;
+    if(bEvent)
+    {
+      m_pWs->text(c.id, s);
+      m_sent[topic]++;
+      continue;
+    }
+    if(c.res[topic] && (c.bSent & bit) && key == c.sentKey[topic]
+      && abs(v - c.sentV[topic]) < c.res[topic]) // what it has is close enough
+      c.pending &= ~bit;
+    else if(ms - c.sentMs[topic] >= c.ms[topic])
+    {
+      m_pWs->text(c.id, s);
+      sent(c, topic, ms);
+    }
+    else
+      c.pending |= bit;
+  }
+}
+
+void WsTopics::sent(wsSub &c, uint8_t t, uint32_t ms)
+{
+  m_sent[t]++;
+  c.sentMs[t] = ms;
+  c.sentV[t] = m_lastV[t];
+  c.sentKey[t] = m_lastKey[t];
+  c.bSent |= 1 << t;
+  c.pending &= ~(1 << t);
+}
+
+void WsTopics::sendTo(uint32_t id, String s)
+{
+  m_pWs->text(id, s);
+}
+
+// free the slots of clients that are gone, a disconnect can be dropped with the command queue full
+void WsTopics::sweep()
+{
+  m_sweepMs = millis();
+  for(uint8_t i = 0; i < WST_CLIENTS; i++)
+    if(m_sub[i].id && m_pWs->client(m_sub[i].id) == NULL)
+    {
+      m_sub[i].id = 0;
+      m_swept++;
+    }
+}
+
+// send what was held back once each client's rate allows
+void WsTopics::service()
+{
+  uint32_t ms = millis();
+
+  if(ms - m_sweepMs >= WST_SWEEP)
+    sweep();
+
+  for(uint8_t i = 0; i < WST_CLIENTS; i++)
+  {
+    wsSub &c = m_sub[i];
+    if(c.id == 0 || c.pending == 0)
+      continue;
+    for(uint8_t t = 0; t < TP_CNT; t++)
+    {
+      if(!(c.pending & (1 << t)) || ms - c.sentMs[t] < c.ms[t])
+        continue;
+      m_pWs->text(c.id, m_last[t]);
+      sent(c, t, ms);
+    }
+  }
+}
+
+String WsTopics::statsJson()
+{
+  jsonString js;
+
+  for(uint8_t t = 0; t < TP_CNT; t++)
+  {
+    uint32_t a[2] = {m_built[t], m_sent[t]};
+    js.Array(topicName[t], a, 2); // serialized, sent
+  }
+  js.Var("full", m_full);
+  js.Var("swept", m_swept);
+  return js.Close();
+}
@@ -0,0 +1,79 @@
+#ifndef WSTOPICS_H
+#define WSTOPICS_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#define WST_CLIENTS 8
+#define WST_SWEEP   5000  // ms between checks for clients that closed without a disconnect event
+
+enum wsTopic
+{
+  TP_STATE,
+  TP_SET,     // settings and schedule pages
+  TP_HIST,    // temperature history
+  TP_RADAR,
+  TP_ALERT,
+  TP_DEBUG,   // print
+  TP_EVENT,   // journal.h
+  TP_RADARCAP, // every radar frame for tools/radarReplay, only when asked for
+  TP_CNT
+};
+
+#define TP_ALL  ((1 << TP_CNT) - 1)
+#define TP_DEF  (TP_ALL & ~(1 << TP_RADARCAP)) // before a client subscribes
+
+struct wsSub
+{
+  uint32_t id;              // websocket client, 0 = free
+  uint8_t  mask;            // subscribed topics
+  uint8_t  pending;         // topics with a newer message held back by the rate
+  uint8_t  bSent;           // topics with sentV and sentKey set
+  uint32_t ms[TP_CNT];      // min ms between messages
+  uint32_t sentMs[TP_CNT];
+  uint16_t res[TP_CNT];     // min change of the topic's value, 0 = every message
+  int32_t  sentV[TP_CNT];
+  uint32_t sentKey[TP_CNT];
+};
+
+// Websocket clients pick the topics they want with {"sub":"state:5000:5,set,alert"}, a topic name
+// with an optional min ms between messages and a resolution.  A publisher gives each message a
+// value and a key: the water temp x10 and the heater, setpoint and presence for state, the
+// distance and class for radar, a count for history.  A client with a resolution only gets a
+// message once the value has moved that far from the one it has, or the key changed, so
+// hist:0:4 is every fourth history update.  Each message is serialized once and only sent to
+// the subscribers.  Held back messages are replaced by newer ones, events are never held.
+// A full table or a lost disconnect is caught by a sweep of the clients the server still has,
+// a client that still doesn't fit gets an alert.  Call only from loop()
+class WsTopics
+{
+public:
+  WsTopics(AsyncWebSocket *pWs);
+  void connect(uint32_t id);
+  void disconnect(uint32_t id);
+  uint8_t subscribe(uint32_t id, char *pList); // returns the topics newly added
+  bool wanted(uint8_t topic);
+  void publish(uint8_t topic, String s, bool bEvent = false, int32_t v = 0, uint32_t key = 0);
+  void sendTo(uint32_t id, String s);
+  void service(void);
+  String statsJson(void);
+private:
+  wsSub *find(uint32_t id);
+  void sweep(void);
+  void sent(wsSub &c, uint8_t t, uint32_t ms);
+
+  AsyncWebSocket *m_pWs;
+  wsSub    m_sub[WST_CLIENTS];
+  String   m_last[TP_CNT];  // latest of each topic
+  int32_t  m_lastV[TP_CNT];
+  uint32_t m_lastKey[TP_CNT];
+  uint32_t m_built[TP_CNT];
+  uint32_t m_sent[TP_CNT];
+  uint32_t m_sweepMs;
+  uint32_t m_full;    // clients with no free slot
+  uint32_t m_swept;   // slots of gone clients freed
+};
+
+extern WsTopics topics;
+
+#endif // WSTOPICS_H